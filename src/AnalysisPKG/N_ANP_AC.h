@@ -118,6 +118,12 @@ class ACExpressionGroup : public Xyce::Util::mainXyceExpressionGroup
 
   virtual bool getCurrentVal( const std::string & deviceName, const std::string & designator, std::complex<double> & retval );
 
+  protected:
+    virtual void getLocalSolutionValues_(
+      const std::vector<int> & gids,
+      std::vector<double> & realVals,
+      std::vector<double> & imagVals);
+
   private:
     const Linear::BlockVector & X_;
 
@@ -59,6 +59,7 @@
 
 #include <N_ANP_AnalysisBase.h>
 #include <N_ANP_AnalysisEvent.h>
+#include <N_ANP_OPCache.h>
 #include <N_ANP_RegisterAnalysis.h>
 #include <N_ANP_StepEvent.h>
 #include <N_TIA_TIAParams.h>
@@ -393,6 +394,11 @@ public:
     return dataStore_;
   }
 
+  OPCache &getOPCache()
+  {
+    return opCache_;
+  }
+
   const AnalysisBase &getAnalysisObject() const
   {
     return *primaryAnalysisObject_;
@@ -573,6 +579,7 @@ private:
 
   Parallel::Manager *                   parallelManager_;               ///< Pointer to the parallel services manager
   TimeIntg::DataStore *                 dataStore_;                     ///< Data store object
+  OPCache                               opCache_;                       ///< Operating points of earlier .STEP/.SAMPLING iterations
 
 
   Mode                  analysisMode_;
@@ -142,7 +142,9 @@ public:
 private:
   void dcSweepOutput();
   void initializeSolution_();
-  void takeStep_ ();
+  void takeStep_ (bool extrapolate = false);
+  bool sweepPredictorAvailable_();
+  void extrapolateSolution_();
 
 private:
   AnalysisManager &                     analysisManager_;
@@ -170,6 +172,13 @@ private:
 
   std::vector < AnalysisBase * > parentAnalysisPtrVec_;
 
+  // Sweep predictor data.  The two most recent converged sweep points,
+  // which correspond to the current and last solutions in the DataStore.
+  std::vector<double>                   currSweepValues_;
+  std::vector<double>                   lastSweepValues_;
+  int                                   sweepHistory_;
+  double                                predictorScale_;
+
 protected:
   int                                   dcLoopSize_;
   SweepVector                           dcSweepVector_;
@@ -0,0 +1,106 @@
+//-------------------------------------------------------------------------
+//   Copyright 2002-2024 National Technology & Engineering Solutions of
+//   Sandia, LLC (NTESS).  Under the terms of Contract DE-NA0003525 with
+//   NTESS, the U.S. Government retains certain rights in this software.
+//
+//   This file is part of the Xyce(TM) Parallel Electrical Simulator.
+//
+//   Xyce(TM) is free software: you can redistribute it and/or modify
+//   it under the terms of the GNU General Public License as published by
+//   the Free Software Foundation, either version 3 of the License, or
+//   (at your option) any later version.
+//
+//   Xyce(TM) is distributed in the hope that it will be useful,
+//   but WITHOUT ANY WARRANTY; without even the implied warranty of
+//   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//   GNU General Public License for more details.
+//
+//   You should have received a copy of the GNU General Public License
+//   along with Xyce(TM).
+//   If not, see <http://www.gnu.org/licenses/>.
+//-------------------------------------------------------------------------
+
+
+//-----------------------------------------------------------------------------
+//
+// Purpose        : Cache of converged DC operating points, keyed by the
+//                  values of the .STEP/.SAMPLING parameters.
+//
+// Special Notes  :
+//
+// Creator        :
+//
+// Creation Date  :
+//
+//-----------------------------------------------------------------------------
+
+#ifndef Xyce_N_ANP_OPCache_h
+#define Xyce_N_ANP_OPCache_h
+
+#include <vector>
+
+#include <N_ANP_fwd.h>
+#include <N_LAS_fwd.h>
+
+namespace Xyce {
+namespace Analysis {
+
+//-----------------------------------------------------------------------------
+// Class         : OPCache
+// Purpose       : Holds the operating point solutions of earlier steps of a
+//                 .STEP or .SAMPLING loop, and seeds the operating point
+//                 solve of a new step from them.
+// Special Notes : Entries are kept oldest first, and the oldest entry is
+//                 dropped once the cache is full.  The stored vectors share
+//                 the map of the solution vector, so the cache has to be
+//                 cleared whenever the linear system is rebuilt.
+// Creator       :
+// Creation Date :
+//-----------------------------------------------------------------------------
+class OPCache
+{
+public:
+  enum Mode {NONE = 0, NEAREST = 1, LINEAR = 2};
+
+  OPCache()
+  {}
+
+  ~OPCache()
+  {
+    clear();
+  }
+
+private:
+  OPCache(const OPCache &);
+  OPCache &operator=(const OPCache &);
+
+public:
+  void clear();
+
+  bool seed(int mode, const std::vector<double> & key, Linear::Vector & solution) const;
+
+  void store(int max_entries, const std::vector<double> & key, const Linear::Vector & solution);
+
+  int size() const
+  {
+    return entries_.size();
+  }
+
+private:
+  void scales(const std::vector<double> & key, std::vector<double> & scale) const;
+
+  struct Entry
+  {
+    std::vector<double>         key_;
+    Linear::Vector *            solution_;
+  };
+
+  std::vector<Entry>            entries_;
+};
+
+void getOPCacheKey(const SweepVector & step_sweep_vector, std::vector<double> & key);
+
+} // namespace Analysis
+} // namespace Xyce
+
+#endif // Xyce_N_ANP_OPCache_h
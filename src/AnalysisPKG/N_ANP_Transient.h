@@ -198,6 +198,8 @@ private:
 
   void takeAnIntegrationStep_();
 
+  void setupLatencyPartitions();
+
   bool retakeAndAcceptTimeStep( double aTimeStep );
 
   void logQueuedData();
@@ -306,6 +308,7 @@ private:
   bool forceAnalytic_;
   bool newLowMem_;
   bool sparseAdjointStorage_;
+  int adjointMemory_;             // forward time points kept in memory for adjoints (0 = all)
 
   double adjointBeginTime_;
   bool adjointBeginTimeGiven_;
@@ -78,6 +78,7 @@ class MOR;
 class MPDE;
 class NOISE;
 class NoiseData;
+class OPCache;
 class OutputAdapter;
 class OutputMgrAdapter;
 class ProcessorBase;
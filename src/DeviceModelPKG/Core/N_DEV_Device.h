@@ -74,6 +74,28 @@ struct DeviceInstanceOp
   virtual bool operator()(DeviceInstance *instance) = 0;
 };
 
+///
+///  Memory used by the instances of one device, as reported by Device::getMemoryUsage
+///
+struct DeviceMemoryUsage
+{
+  DeviceMemoryUsage()
+    : numInstances(0),
+      instanceBytes(0),
+      indexBytes(0),
+      stampBytes(0),
+      numStamps(0),
+      numStampPatterns(0)
+  {}
+
+  int           numInstances;           ///< Number of instances
+  size_t        instanceBytes;          ///< sizeof the instance objects
+  size_t        indexBytes;             ///< LID and Jacobian LID vectors owned by the instances
+  size_t        stampBytes;             ///< Jacobian stamps, counting a stamp shared by several instances once
+  int           numStamps;              ///< Number of distinct Jacobian stamp objects
+  int           numStampPatterns;       ///< Number of distinct Jacobian stamp patterns
+};
+
 //-----------------------------------------------------------------------------
 // Class         : Device
 // Purpose       :
@@ -274,6 +296,41 @@ public:
   ///
   virtual DeviceInstance *addInstance(const InstanceBlock &instance_block, const FactoryBlock &factory_block) = 0;
 
+  //-----------------------------------------------------------------------------
+  // Function      : reserveInstances
+  // Purpose       :
+  // Special Notes :
+  // Scope         : public
+  // Creator       : 
+  // Creation Date : 
+  //-----------------------------------------------------------------------------
+  ///
+  ///  Reserves storage for instances that are about to be added
+  ///
+  ///  This is a hint issued by the device manager before a batch of addInstance() calls, so the device containers
+  ///  are grown once rather than once per instance.
+  ///
+  ///  @param count             number of instances that will be added to this device
+  ///
+  virtual void reserveInstances(int count)
+  {}
+
+  //-----------------------------------------------------------------------------
+  // Function      : getMemoryUsage
+  // Purpose       :
+  // Special Notes :
+  // Scope         : public
+  // Creator       : 
+  // Creation Date : 
+  //-----------------------------------------------------------------------------
+  ///
+  ///  Adds the memory used by the instances of this device to usage
+  ///
+  ///  @param usage             memory usage to accumulate into
+  ///
+  virtual void getMemoryUsage(DeviceMemoryUsage &usage) const
+  {}
+
   //-----------------------------------------------------------------------------
   // Function      : updateSources
   // Purpose       :
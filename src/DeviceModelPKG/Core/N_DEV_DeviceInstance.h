@@ -360,6 +360,8 @@ public:
     return staLIDVec;
   }
 
+  size_t getIndexMemoryUsage() const;
+
   bool getMergeRowColChecked() const 
   {
     return mergeRowColChecked;
@@ -560,6 +562,8 @@ inline bool DeviceInstance::updateSource ()
   return true;
 }
 
+size_t jacobianStampMemoryUsage(const JacobianStamp &stamp);
+
 inline void addInternalNode(Util::SymbolTable &symbol_table, int index, const InstanceName &instance_name, const std::string &lead_name) {
   Util::addSymbol(symbol_table, Util::SOLUTION_SYMBOL, index, spiceInternalName(instance_name, lead_name));
 }
@@ -45,6 +45,7 @@
 
 #include <unordered_map>
 using std::unordered_map;
+#include <set>
 #include <string>
 #include <vector>
 
@@ -330,6 +331,8 @@ public:
   virtual ModelType *addModel(const ModelBlock & MB, const FactoryBlock &factory_block) /* override */;
   virtual InstanceType *addInstance(const InstanceBlock &instance_block, const FactoryBlock &factory_block); /* override */
   virtual void storeInstance(const FactoryBlock& factory_block, InstanceType* instance); /* override */
+  virtual void reserveInstances(int count); /* override */
+  virtual void getMemoryUsage(DeviceMemoryUsage &usage) const; /* override */
 
   virtual bool updateSources() /* override */;
   virtual bool updateState (double * solVec, double * staVec, double * stoVec)/* override */;
@@ -532,6 +535,61 @@ DeviceMaster<T>::addInstance(
   return (*result.first).second;
 }
 
+//-----------------------------------------------------------------------------
+// Function      : DeviceMaster::reserveInstances
+// Purpose       : Grow the instance containers ahead of a batch of addInstance
+//                 calls.
+// Special Notes : Called from DeviceMgr::reserveDeviceInstances with the number
+//                 of instances of this device that are about to be created.
+// Scope         : public
+// Creator       : 
+// Creation Date : 
+//-----------------------------------------------------------------------------
+template<class T>
+void DeviceMaster<T>::reserveInstances(int count)
+{
+  if (count > 0)
+  {
+    instanceVector_.reserve(instanceVector_.size() + count);
+    instanceMap_.reserve(instanceMap_.size() + count);
+  }
+}
+
+//-----------------------------------------------------------------------------
+// Function      : DeviceMaster::getMemoryUsage
+// Purpose       : Accumulate the memory used by the instances of this device.
+// Special Notes : Jacobian stamps are identified by address, so a stamp that
+//                 is shared (static, or per model) is only counted once.  The
+//                 number of distinct stamp patterns shows how much could be
+//                 saved by sharing the stamps that are not.
+// Scope         : public
+// Creator       : 
+// Creation Date : 
+//-----------------------------------------------------------------------------
+template<class T>
+void DeviceMaster<T>::getMemoryUsage(DeviceMemoryUsage &usage) const
+{
+  std::set<const JacobianStamp *> stamps;
+  std::set<JacobianStamp> stamp_patterns;
+
+  for (typename InstanceVector::const_iterator it = instanceVector_.begin(); it != instanceVector_.end(); ++it)
+  {
+    usage.instanceBytes += sizeof(InstanceType);
+    usage.indexBytes += (*it)->getIndexMemoryUsage();
+
+    const JacobianStamp &stamp = (*it)->jacobianStamp();
+    if (stamps.insert(&stamp).second)
+    {
+      usage.stampBytes += jacobianStampMemoryUsage(stamp);
+      stamp_patterns.insert(stamp);
+    }
+  }
+
+  usage.numInstances += instanceVector_.size();
+  usage.numStamps += stamps.size();
+  usage.numStampPatterns += stamp_patterns.size();
+}
+
 //-----------------------------------------------------------------------------
 // Function      : DeviceMaster::addModel
 // Purpose       : This function adds a model to the list of device models.
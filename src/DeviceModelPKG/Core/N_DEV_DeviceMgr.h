@@ -181,6 +181,8 @@ public:
 
   bool verifyDeviceInstance(const InstanceBlock & IB);
 
+  void reserveDeviceInstances(const std::vector<const InstanceBlock *> & instance_blocks);
+
   DeviceInstance * addDeviceInstance(const InstanceBlock & IB);
 
   bool deleteDeviceInstance (const std::string & name);
@@ -222,6 +224,15 @@ public:
 
   bool analyticSensitivitiesAvailable(const std::string & name);
   bool numericalSensitivitiesAvailable(const std::string & name);
+
+  bool getGlobalParamNumericalSensitivities(
+      const std::string & name,
+      std::vector<double> & dfdpVec,
+      std::vector<double> & dqdpVec,
+      std::vector<double> & dbdpVec,
+      std::vector<int> & FindicesVec,
+      std::vector<int> & QindicesVec,
+      std::vector<int> & BindicesVec);
 //
 
   void getAnalyticalBSensVectorsforAC (const std::string & name,
@@ -510,6 +521,15 @@ public:
 
   void addDevicesToCount(const DeviceCountMap &device_map);
 
+  void getDeviceMemoryUsage(DeviceMemoryUsageMap &memory_usage_map) const;
+
+  void getDeviceLoadTime(DeviceLoadTimeMap &load_time_map) const;
+
+  double getLoadBarrierTime() const
+  {
+    return loadBarrierTime_;
+  }
+
   DeviceEntity *getDeviceEntity(const std::string &full_param_name) const;
 
   DeviceInstance * getMutualInductorDeviceInstance (
@@ -646,6 +666,10 @@ private:
 
   DeviceVector                  devicePtrVec_;
   DeviceVector                  pdeDevicePtrVec_;
+  std::map<ModelTypeId, int>    pendingInstanceReservations_; ///< instance counts for devices not created yet, see reserveDeviceInstances
+
+  std::map<const Device *, double> deviceLoadTime_;     ///< accumulated load time of each device, if LOADREPORT
+  double                        loadBarrierTime_;       ///< accumulated wait at the barrier ending each load, if LOADREPORT
 
   InstanceVector                instancePtrVec_;
   InstanceVector                devicesWithMaxTimeStepFuncsPtrVec_;
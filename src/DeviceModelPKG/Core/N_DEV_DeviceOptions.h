@@ -175,6 +175,9 @@ public:
   bool          separateLoad;   ///< used to enable separated device loading
 
   bool          pwl_BP_off;     ///< if true, then PWL sources have no breakpoints
+
+  bool          memoryReport;   ///< if true, report the memory used by each device type after instantiation
+  bool          loadReport;     ///< if true, time the loads of each device type and report the balance over processors
 };
 
 } // namespace Device
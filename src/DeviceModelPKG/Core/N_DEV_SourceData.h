@@ -414,13 +414,15 @@ private:
 
 public:
   virtual bool updateSource() /* override */ ;
-  virtual void setupBreakPoints() { preComputedBreakpointsDone = false; }
+  virtual void setupBreakPoints() { nextBreakPointIndex_ = 0; nextBreakPointBase_ = 0.0; }
   bool getBreakPoints( std::vector<Util::BreakPoint> & breakPointTimes);
   void getParams (double *);
   void setParams (double *);
   void printOutParams ();
 
 private:
+  int findSegment_(double t, int hint) const;
+
   // Data Members for Class Attributes
   int NUM; //number of time,voltage pairs
   bool REPEAT; //repeat cycle?
@@ -432,7 +434,8 @@ private:
   std::vector< std::pair<int,Util::Expression> >  timeExprList;
 
   int loc_; //current location in time vector
-  bool preComputedBreakpointsDone;
+  int nextBreakPointIndex_; //first point not yet sent as a breakpoint
+  double nextBreakPointBase_; //period start time of that point, for a repeating signal
 };
 
 //-----------------------------------------------------------------------------
@@ -72,6 +72,7 @@ class DeviceMgr;
 typedef DeviceMgr DeviceInterface; // DEPRECATED, use DeviceMgr
 
 class DeviceModel;
+struct DeviceMemoryUsage;
 class DeviceOptions;
 class DeviceSensitivities;
 class DeviceState;
@@ -155,6 +156,8 @@ typedef unordered_set<std::string, HashNoCase, EqualNoCase> PassthroughParameter
 
 
 typedef std::map<std::string, int, LessNoCase> DeviceCountMap;
+typedef std::map<std::string, DeviceMemoryUsage, LessNoCase> DeviceMemoryUsageMap;
+typedef std::map<std::string, double, LessNoCase> DeviceLoadTimeMap;
 
 typedef std::vector<CompositeParam *> CompositeVector;
 
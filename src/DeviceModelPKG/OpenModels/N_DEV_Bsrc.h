@@ -332,6 +332,14 @@ public:
 
   // load functions, Jacobian:
   virtual bool loadDAEMatrices (Linear::Matrix & dFdx, Linear::Matrix & dQdx);
+
+private:
+  // work space for evaluating the instance expressions together
+  std::vector<Instance *> batchInstances_;
+  std::vector<Util::Expression *> batchExprs_;
+  std::vector<double> batchVals_;
+  std::vector< std::vector<double> > batchDerivs_;
+  std::vector<bool> batchChanged_;
 };
 
 void registerDevice(const DeviceCountMap& deviceMap = DeviceCountMap(),
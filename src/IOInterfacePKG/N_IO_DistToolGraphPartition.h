@@ -0,0 +1,137 @@
+//-------------------------------------------------------------------------
+//   Copyright 2002-2024 National Technology & Engineering Solutions of
+//   Sandia, LLC (NTESS).  Under the terms of Contract DE-NA0003525 with
+//   NTESS, the U.S. Government retains certain rights in this software.
+//
+//   This file is part of the Xyce(TM) Parallel Electrical Simulator.
+//
+//   Xyce(TM) is free software: you can redistribute it and/or modify
+//   it under the terms of the GNU General Public License as published by
+//   the Free Software Foundation, either version 3 of the License, or
+//   (at your option) any later version.
+//
+//   Xyce(TM) is distributed in the hope that it will be useful,
+//   but WITHOUT ANY WARRANTY; without even the implied warranty of
+//   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//   GNU General Public License for more details.
+//
+//   You should have received a copy of the GNU General Public License
+//   along with Xyce(TM).
+//   If not, see <http://www.gnu.org/licenses/>.
+//-------------------------------------------------------------------------
+//-----------------------------------------------------------------------------
+//
+// Purpose        : Declares the DistToolGraphPartition class.  Distribution
+//                  tool that assigns devices to processors by partitioning
+//                  the device-node hypergraph of a flat netlist.
+//
+// Special Notes  :
+//
+// Creator        :
+//
+// Creation Date  :
+//
+//-----------------------------------------------------------------------------
+
+#ifndef Xyce_N_IO_DistToolGraphPartition_h
+#define Xyce_N_IO_DistToolGraphPartition_h
+
+#include <vector>
+#include <string>
+
+#include <N_IO_fwd.h>
+#include <N_PDS_fwd.h>
+#include <N_IO_CircuitContext.h>
+#include <N_IO_SpiceSeparatedFieldTool.h>
+#include <N_IO_DistributionTool.h>
+#include <N_IO_DistToolBase.h>
+
+namespace Xyce {
+namespace IO {
+
+//-----------------------------------------------------------------------------
+// Class          : DistToolGraphPartition
+// Purpose        : Buffers and distributes device lines for/during parsing.
+//                  Processor zero reads every device line of the netlist,
+//                  partitions the device-node hypergraph so that each
+//                  processor gets a connected piece of the circuit with a
+//                  balanced estimated evaluation cost, and sends each
+//                  processor its devices.
+// Special Notes  : Like the flat round-robin strategy, this can only be
+//                  applied to flattened (non-hierarchical) netlists.
+//                  Voltage nodes are later owned by one of the processors
+//                  holding a connected device, so keeping connected devices
+//                  together also keeps matrix rows with the devices that
+//                  load them.
+//-----------------------------------------------------------------------------
+class DistToolGraphPartition: public DistToolBase
+{
+public:
+  DistToolGraphPartition(
+    Parallel::Communicator *                 pdsCommPtr,
+    CircuitBlock &                           circuit_block,
+    std::map<std::string,FileSSFPair>      & ssfMap,
+    std::map<std::string, IncludeFileInfo> & iflMap,
+    const ParsingMgr                       & parsing_manager
+    );
+
+  virtual ~DistToolGraphPartition() {}
+
+  // send options, metatdata, and context to all procs
+  bool broadcastGlobalData();
+
+  // Distribute devices according to a partition of the circuit graph.
+  void distributeDevices();
+
+protected:
+
+  // Parse the given include file for 2nd pass
+  bool parseIncludeFile(std::string const& includeFiles,
+                        const std::string &libSelect)
+  { // Throw error here!
+    return false;
+  }
+
+  // helper function for parseIncludeFile()
+  void restorePrevssfInfo(
+    SpiceSeparatedFieldTool* oldssfPtr,
+    const std::string& old_netlistFilename,
+    int oldFilePos,
+    int oldLineNumber)
+  {}
+
+  bool expandSubcircuitInstance(DeviceBlock & subcircuitInstance,
+                                const std::string &libSelect,
+                                std::vector<std::string> &libInside)
+  { // Throw error here!
+    return false;
+  }
+
+private:
+  // read all device lines of the netlist on proc 0
+  void readDeviceLines(std::vector<TokenVector> & deviceLines);
+
+  // assign each device line to a processor
+  void partitionDeviceLines(const std::vector<TokenVector> & deviceLines,
+                            std::vector<int> & procs);
+
+  // estimated relative cost of evaluating the device on a line
+  int estimateDeviceWeight(const TokenVector & deviceLine, const CircuitMetadata & metadata, int & modelLevel) const;
+
+  // send proc its device lines from proc 0
+  void sendDeviceLines(int proc, const std::vector<TokenVector> & deviceLines,
+                       const std::vector<int> & procs);
+
+  // receive device lines from proc 0 and process them
+  void receiveDeviceLines();
+
+  void setFileName ( std::string const & fileNameIn );
+
+private:
+  std::map<std::string, IncludeFileInfo> & iflMap_;
+};
+
+} // namespace IO
+} // namespace Xyce
+
+#endif // Xyce_N_IO_DistToolGraphPartition_h
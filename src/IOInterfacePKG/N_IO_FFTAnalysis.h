@@ -135,6 +135,7 @@ public:
 
 private:
   void calculateResults_();
+  void resampleData_();
   bool interpolateData_();
   bool applyWindowFunction_();
 
@@ -176,6 +177,7 @@ private:
   bool fftout_;
   int fft_mode_;
   int sampleIdx_;
+  int nextSample_;        // first sample not yet interpolated, if fft_accurate_ is false
   double noiseFloor_;
   double maxMag_;
   double normalization_;  // used for outputting in NORM vs. UNORM format
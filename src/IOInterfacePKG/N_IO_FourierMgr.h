@@ -106,6 +106,8 @@ public:
   std::set<std::string> getDevicesNeedingLeadCurrents() { return devicesNeedingLeadCurrents_; }
 
 private:
+  void trimHistory_(double circuitTime);
+
   void getLastPeriod_();
 
   bool interpolateData_();
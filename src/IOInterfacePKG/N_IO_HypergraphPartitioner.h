@@ -0,0 +1,119 @@
+//-------------------------------------------------------------------------
+//   Copyright 2002-2024 National Technology & Engineering Solutions of
+//   Sandia, LLC (NTESS).  Under the terms of Contract DE-NA0003525 with
+//   NTESS, the U.S. Government retains certain rights in this software.
+//
+//   This file is part of the Xyce(TM) Parallel Electrical Simulator.
+//
+//   Xyce(TM) is free software: you can redistribute it and/or modify
+//   it under the terms of the GNU General Public License as published by
+//   the Free Software Foundation, either version 3 of the License, or
+//   (at your option) any later version.
+//
+//   Xyce(TM) is distributed in the hope that it will be useful,
+//   but WITHOUT ANY WARRANTY; without even the implied warranty of
+//   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//   GNU General Public License for more details.
+//
+//   You should have received a copy of the GNU General Public License
+//   along with Xyce(TM).
+//   If not, see <http://www.gnu.org/licenses/>.
+//-------------------------------------------------------------------------
+//-----------------------------------------------------------------------------
+//
+// Purpose        : Multilevel partitioner for the device-node hypergraph
+//                  used by the graph-partitioned distribution tool.
+//
+// Special Notes  : The hypergraph is approximated by a weighted graph (each
+//                  net contributes a clique with edge weight 1/(pins-1)).
+//                  Nets larger than the clique limit, such as supply rails,
+//                  are left out of the graph because they are cut by any
+//                  reasonable partition anyway.
+//
+// Creator        :
+//
+// Creation Date  :
+//
+//-----------------------------------------------------------------------------
+
+#ifndef Xyce_N_IO_HypergraphPartitioner_h
+#define Xyce_N_IO_HypergraphPartitioner_h
+
+#include <vector>
+
+namespace Xyce {
+namespace IO {
+
+//-----------------------------------------------------------------------------
+// Class         : HypergraphPartitioner
+// Purpose       : Partition weighted vertices into balanced parts while
+//                 minimizing the number of nets that span several parts.
+// Special Notes : Nets are given in compressed form: the pins of net n are
+//                 netPins[netPtr[n]] ... netPins[netPtr[n+1]-1].
+//                 The partitioner is serial and deterministic; it coarsens by
+//                 heavy-edge matching, partitions the coarsest graph by
+//                 splitting a breadth-first ordering, and refines each level
+//                 with greedy boundary moves.
+// Creator       :
+// Creation Date :
+//-----------------------------------------------------------------------------
+class HypergraphPartitioner
+{
+public:
+  HypergraphPartitioner(
+    const std::vector<int> &    vertexWeights,
+    const std::vector<int> &    netPtr,
+    const std::vector<int> &    netPins);
+
+  // Allowed relative overweight of a part, e.g. 0.05 for 5%.
+  void setImbalanceTolerance(double tol)
+  {
+    imbalanceTol_ = tol;
+  }
+
+  // Nets with more pins than this are not used to build the graph.
+  void setMaxNetSize(int maxNetSize)
+  {
+    maxNetSize_ = maxNetSize;
+  }
+
+  // Assign each vertex to one of numParts parts.
+  void partition(int numParts, std::vector<int> & parts) const;
+
+  // Sum over nets of (number of parts spanned - 1).
+  int connectivityCut(const std::vector<int> & parts) const;
+
+private:
+  struct Graph
+  {
+    std::vector<int>    ptr;
+    std::vector<int>    adj;
+    std::vector<double> ewgt;
+    std::vector<int>    vwgt;
+
+    int numVertices() const
+    {
+      return vwgt.size();
+    }
+  };
+
+  void buildGraph_(Graph & graph) const;
+
+  bool coarsen_(const Graph & fine, int maxVertexWeight, Graph & coarse, std::vector<int> & cmap) const;
+
+  void initialPartition_(const Graph & graph, int numParts, std::vector<int> & parts) const;
+
+  void refine_(const Graph & graph, int numParts, std::vector<int> & parts) const;
+
+private:
+  const std::vector<int> &      vertexWeights_;
+  const std::vector<int> &      netPtr_;
+  const std::vector<int> &      netPins_;
+  double                        imbalanceTol_;          ///< allowed relative overweight of a part
+  int                           maxNetSize_;            ///< larger nets are left out of the graph
+};
+
+} // namespace IO
+} // namespace Xyce
+
+#endif // Xyce_N_IO_HypergraphPartitioner_h
@@ -75,6 +75,21 @@ printDeviceCount(
   std::ostream &                os,
   const DeviceCountMap &        device_count_map);
 
+// Gather and print the memory used by each device type.
+std::ostream &
+printDeviceMemoryUsage(
+  Parallel::Machine                     comm,
+  std::ostream &                        os,
+  const Device::DeviceMemoryUsageMap &  memory_usage_map);
+
+// Gather and print the load time of each device type over processors.
+std::ostream &
+printDeviceLoadBalance(
+  Parallel::Machine                     comm,
+  std::ostream &                        os,
+  const Device::DeviceLoadTimeMap &     load_time_map,
+  double                                barrier_time);
+
 } // namespace IO
 } // namespace Xyce
 
@@ -55,7 +55,7 @@ enum PreprocessType {REDUNDANT_C, REDUNDANT_D, REDUNDANT_I, REDUNDANT_L, REDUNDA
 }
 
 namespace DistStrategy {
-enum DistStrategy {DEFAULT, FLAT_ROUND_ROBIN, DEVICE_BALANCED, NUM_STRATEGIES};
+enum DistStrategy {DEFAULT, FLAT_ROUND_ROBIN, DEVICE_BALANCED, GRAPH_PARTITION, NUM_STRATEGIES};
 }
 
 class ActiveOutput;
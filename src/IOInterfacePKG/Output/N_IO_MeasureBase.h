@@ -164,6 +164,9 @@ public:
 
     void makeMeasureOps(Parallel::Machine comm, const Util::Op::BuilderManager &op_builder_manager);
 
+    // share the evaluation of this measure's output variables with other measures
+    void registerSignals(SignalCache &signal_cache);
+
     // used to call the output manager's getPrgetImmutableValue<int>()
     double getOutputValue(
       Parallel::Machine comm,
@@ -282,6 +285,9 @@ protected:
     int numDepSolVars_;
     Util::ParamList depSolVarIterVector_;
     Util::Op::OpList outputVars_;
+    // slot in the manager's signal cache for each of the outputVars_, or -1
+    SignalCache *signalCache_;
+    std::vector<int> signalSlots_;
     double outputValueTarget_;
     bool  outputValueTargetGiven_;
     double lastOutputValue_;
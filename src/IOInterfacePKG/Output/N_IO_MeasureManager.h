@@ -39,8 +39,10 @@
 #define Xyce_N_IO_MeasureManager_H
 
 #include <list>
+#include <map>
 #include <string>
 #include <iostream>
+#include <vector>
 
 #include <N_IO_fwd.h>
 #include <N_PDS_fwd.h>
@@ -62,6 +64,55 @@ namespace Xyce {
 namespace IO {
 namespace Measure {
 
+//-----------------------------------------------------------------------------
+// Class         : SignalCache
+// Purpose       : Holds the values of the output variables that are shared
+//                 by more than one measure, so that each distinct signal is
+//                 evaluated (and reduced in parallel) only once per step
+// Special Notes : Only operators whose value depends solely on the vectors
+//                 passed to the measures are registered.  Expression and
+//                 measure operators carry their own state and are always
+//                 evaluated by the measure that owns them.  The slot
+//                 assignment is made in the same order on every processor.
+// Creator       :
+// Creation Date :
+//-----------------------------------------------------------------------------
+class SignalCache
+{
+public:
+  SignalCache()
+    : generation_(1)
+  {}
+
+  // returns the slot for this operator, or -1 if it can not be shared
+  int addSignal(const Util::Op::Operator &op);
+
+  // called by the manager before each update of the active measures
+  void invalidate() { ++generation_; }
+
+  bool findValue(int slot, complex &value) const
+  {
+    if (stamps_[slot] != generation_)
+      return false;
+    value = values_[slot];
+    return true;
+  }
+
+  void setValue(int slot, const complex &value)
+  {
+    values_[slot] = value;
+    stamps_[slot] = generation_;
+  }
+
+  int getNumSignals() const { return values_.size(); }
+
+private:
+  std::map<std::pair<Util::Op::Identifier, std::string>, int> slotMap_;
+  std::vector<complex>        values_;
+  std::vector<unsigned long>  stamps_;
+  unsigned long               generation_;
+};
+
 //-----------------------------------------------------------------------------
 // Class         : MeasureManager
 // Purpose       : This is a manager class for handling measure statements
@@ -229,6 +280,9 @@ private:
   std::set<std::string> devicesNeedingLeadCurrents_;   
 
   Teuchos::RCP<Xyce::Util::baseExpressionGroup> expressionGroup_; ///< required for setting up expressions
+
+  // values of the output variables shared between measures, for the current step
+  SignalCache           signalCache_;
 };
 
 bool isComplexCurrentOp(const std::string& name, int parenIdx);
@@ -41,6 +41,7 @@ namespace IO {
 namespace Measure {
 
 class Base;
+class SignalCache;
 class Extrema;
 class FFT;
 class Stats;
@@ -91,6 +91,10 @@ public:
   // multiple RHS solves.
   int doSolve( bool reuse_factors, bool transpose = false );
 
+  // Solve for all the vectors in b with a single call to the wrapped solver,
+  // using the factors from the previous solve.
+  int doSolveMultiple( MultiVector & x, const MultiVector & b, bool transpose = false );
+
 private:
 
   //Solver Type
@@ -67,7 +67,8 @@ public:
   // Default Constructor
   Builder()
   : pdsMgr_(0),
-    lasQueryUtil_(0)
+    lasQueryUtil_(0),
+    matrixFree_(false)
   {}
 
   // Destructor
@@ -84,6 +85,17 @@ public:
     return (lasQueryUtil_ = LAS_QUtil);
   }
 
+  // A matrix free builder generates no matrix graphs and creates no matrices.
+  void setMatrixFree(bool matrixFree)
+  {
+    matrixFree_ = matrixFree;
+  }
+
+  bool matrixFree() const
+  {
+    return matrixFree_;
+  }
+
   // Vector and Matrix creators which use QueryUtil and ParMap
   // attributes to transparently construct proper objects for this linear
   // system
@@ -140,6 +152,7 @@ protected:
 
   Parallel::Manager *       pdsMgr_;
   QueryUtil *               lasQueryUtil_;
+  bool                      matrixFree_;
 };
 
 } // namespace Linear
@@ -39,11 +39,13 @@
 #define Xyce_N_LAS_IRSolver_h
 
 #include <string>
+#include <vector>
 
 #include <N_LAS_fwd.h>
 #include <N_UTL_fwd.h>
 
 #include <N_LAS_Solver.h>
+#include <N_LAS_SparseLU.h>
 #include <N_LAS_TransformTool.h>
 #include <Teuchos_RCP.hpp>
 
@@ -69,7 +71,8 @@ public:
   // Constructor
   IRSolver(
     Problem &                   problem,
-    Util::OptionBlock &         options);
+    Util::OptionBlock &         options,
+    bool                        single_precision = false);
 
   // Destructor
   ~IRSolver();
@@ -90,6 +93,14 @@ public:
   // multiple RHS solves.
   int doSolve( bool reuse_factors, bool transpose = false );
 
+private:
+
+  // Solve using the single precision factors, refined against the matrix.
+  int singleSolve_( Epetra_LinearProblem & prob, bool reuse_factors, bool transpose );
+
+  // Copy the matrix, or its transpose, into compressed column form.
+  bool extractCSC_( const Epetra_CrsMatrix & A, bool transpose );
+
 private:
 
   //Solver Type
@@ -110,6 +121,22 @@ private:
 
   //Repivot every time or use static pivoting
   bool repivot_;
+
+  //Factor a single precision copy of the matrix (TYPE=MIXEDIR)
+  bool singlePrecision_;
+  int numStalls_;
+  SparseLU<float> singleLU_;
+
+  //Compressed column copy of the matrix for singleLU_
+  bool cscTranspose_;
+  std::vector<int> cscColPtr_;
+  std::vector<int> cscRowInd_;
+  std::vector<int> cscPerm_;
+  std::vector<double> cscValues_;
+
+  //Row pattern of the matrix the compressed column copy was built from
+  std::vector<int> patternRowPtr_;
+  std::vector<int> patternColInd_;
   
   //Output linear system every outputLS_ calls
   int outputLS_;
@@ -0,0 +1,139 @@
+//-------------------------------------------------------------------------
+//   Copyright 2002-2024 National Technology & Engineering Solutions of
+//   Sandia, LLC (NTESS).  Under the terms of Contract DE-NA0003525 with
+//   NTESS, the U.S. Government retains certain rights in this software.
+//
+//   This file is part of the Xyce(TM) Parallel Electrical Simulator.
+//
+//   Xyce(TM) is free software: you can redistribute it and/or modify
+//   it under the terms of the GNU General Public License as published by
+//   the Free Software Foundation, either version 3 of the License, or
+//   (at your option) any later version.
+//
+//   Xyce(TM) is distributed in the hope that it will be useful,
+//   but WITHOUT ANY WARRANTY; without even the implied warranty of
+//   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//   GNU General Public License for more details.
+//
+//   You should have received a copy of the GNU General Public License
+//   along with Xyce(TM).
+//   If not, see <http://www.gnu.org/licenses/>.
+//-------------------------------------------------------------------------
+
+
+//-----------------------------------------------------------------------------
+//
+// Purpose        : Jacobi preconditioner for matrix free linear problems
+//
+// Special Notes  : The diagonal is probed from the operator, so no matrix is
+//                  needed.
+//
+// Creator        :
+//
+// Creation Date  :
+//
+//-----------------------------------------------------------------------------
+
+#ifndef Xyce_N_LAS_JacobiPrecond_h
+#define Xyce_N_LAS_JacobiPrecond_h
+
+// ----------   Xyce Includes   ----------
+#include <N_UTL_fwd.h>
+#include <N_LAS_fwd.h>
+
+#include <N_LAS_Preconditioner.h>
+#include <N_LAS_EpetraProblem.h>
+
+// ---------- Trilinos Includes ----------
+
+#include <Teuchos_RCP.hpp>
+
+// ----------  Fwd Declares     ----------
+
+class Epetra_Operator;
+class Epetra_Vector;
+
+namespace Xyce {
+namespace Linear {
+
+//-----------------------------------------------------------------------------
+// Class         : JacobiPrecond
+// Purpose       : Jacobi (diagonal) preconditioner for operators that are
+//                 only available through their apply.
+// Special Notes : The unknowns are colored cyclically by global id, and the
+//                 operator is applied once per color to the indicator vector
+//                 of that color.  The diagonal of a row is then exact unless
+//                 the row has an off-diagonal entry in a column of the same
+//                 color.  Rows with a zero diagonal, such as voltage source
+//                 branch equations, and rows whose probe is small against
+//                 the rest of the row (jacobi_diagtol) are left unscaled.
+// Creator       :
+// Creation Date :
+//-----------------------------------------------------------------------------
+class JacobiPrecond : public Preconditioner
+{
+
+public:
+  // Constructors
+  JacobiPrecond();
+
+  // Destructor
+  virtual ~JacobiPrecond() {}
+
+  // Set the preconditioner options
+  bool setOptions(const Util::OptionBlock & OB);
+  bool setDefaultOptions();
+
+  // Set individual preconditioner options
+  bool setParam( const Util::Param & param );
+
+  // There is no matrix pattern to set.
+  bool initGraph( const Teuchos::RCP<Problem> & problem ) { return true; }
+
+  // Set the operator whose diagonal is probed
+  bool initValues( const Teuchos::RCP<Problem> & problem );
+
+  // Probe the diagonal of the current operator.
+  bool compute();
+
+  // Apply the preconditioner; y = M*x.
+  int apply( MultiVector & x, MultiVector & y );
+
+  // Return the preconditioner as an Epetra_Operator object.
+  Teuchos::RCP<Epetra_Operator> epetraObj() { return epetraPrec_; }
+
+private:
+
+  // Number of colors used to probe the diagonal
+  int numColors_;
+
+  // Smallest accepted ratio of a probed diagonal to the probed row magnitude
+  double diagTol_;
+
+  // Default preconditioner values
+  static const int numColors_default_;
+  static const double diagTol_default_;
+
+  // Current problem being preconditioned.
+  Teuchos::RCP<EpetraProblem> problem_;
+
+  // Inverse of the probed diagonal.
+  Teuchos::RCP<Epetra_Vector> invDiag_;
+
+  // Preconditioner as an Epetra_Operator object.
+  Teuchos::RCP<Epetra_Operator> epetraPrec_;
+
+  // No copying
+  JacobiPrecond(const JacobiPrecond & right);
+  JacobiPrecond & operator=(const JacobiPrecond & right);
+
+  // No comparison
+  bool operator==(const JacobiPrecond & right) const;
+  bool operator!=(const JacobiPrecond & right) const;
+
+};
+
+} // namespace Linear
+} // namespace Xyce
+
+#endif // Xyce_N_LAS_JacobiPrecond_h
@@ -117,9 +117,12 @@ private:
 };
 
 // Generate basis vectors for K(inv(G + s0*C)*C, R), where Op = inv(G + s0*C)*C
+// The basis stops at the first block that is rank deficient, its number of vectors is
+// returned in basisSize.  Returns null if numBlocks or blockSize is less than one, or
+// the basis cannot be computed or is empty.
 Teuchos::RCP<const Linear::MultiVector> createKrylovBasis( const Teuchos::RCP<Linear::MORGenOp>& Op,
                                                            const Teuchos::RCP<Linear::MultiVector>& R,
-                                                           int numBlocks, int blockSize );
+                                                           int numBlocks, int blockSize, int & basisSize );
 
 // Get a multivector that views the first k columns of the input multivector V.
 Linear::MultiVector* cloneView( Linear::MultiVector* V, int k );
@@ -108,6 +108,19 @@ public:
 
     return doSolve(reuse_factors, true);
   }
+
+  // Solve for every vector in b using the factors from the previous solve,
+  // placing the solutions in x.  The LHS and RHS of the linear problem may
+  // be overwritten.
+  virtual int doSolveMultiple( MultiVector & x, const MultiVector & b, bool transpose = false );
+
+  int solveMultiple( MultiVector & x, const MultiVector & b, bool transpose = false )
+  {
+    Stats::StatTop _linearSolveStat("Linear Solve Multiple");
+    Xyce::Stats::TimeBlock _linearSolveTimer(_linearSolveStat);
+
+    return doSolveMultiple(x, b, transpose);
+  }
   
   const Problem& getProblem() { return lasProblem_; }
 
@@ -0,0 +1,421 @@
+//-------------------------------------------------------------------------
+//   Copyright 2002-2024 National Technology & Engineering Solutions of
+//   Sandia, LLC (NTESS).  Under the terms of Contract DE-NA0003525 with
+//   NTESS, the U.S. Government retains certain rights in this software.
+//
+//   This file is part of the Xyce(TM) Parallel Electrical Simulator.
+//
+//   Xyce(TM) is free software: you can redistribute it and/or modify
+//   it under the terms of the GNU General Public License as published by
+//   the Free Software Foundation, either version 3 of the License, or
+//   (at your option) any later version.
+//
+//   Xyce(TM) is distributed in the hope that it will be useful,
+//   but WITHOUT ANY WARRANTY; without even the implied warranty of
+//   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//   GNU General Public License for more details.
+//
+//   You should have received a copy of the GNU General Public License
+//   along with Xyce(TM).
+//   If not, see <http://www.gnu.org/licenses/>.
+//-------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+//
+// Purpose        : Serial sparse LU factorization with a selectable scalar
+//                  precision.
+//
+// Special Notes  : Left-looking (Gilbert-Peierls) factorization of a matrix
+//                  in compressed column form, with threshold partial
+//                  pivoting that prefers the diagonal.  No fill reducing
+//                  ordering is done here; callers are expected to order the
+//                  matrix first (e.g. with the AMD transform), without it
+//                  the fill in of circuit matrices can be severe.
+//
+//                  The factors are stored in Scalar, but the input matrix
+//                  and the right hand sides are double.  This is what
+//                  allows a single precision factorization to be used for
+//                  iterative refinement against the double precision matrix.
+//
+// Creator        :
+//
+// Creation Date  :
+//
+//-----------------------------------------------------------------------------
+
+#ifndef Xyce_N_LAS_SparseLU_h
+#define Xyce_N_LAS_SparseLU_h
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <vector>
+
+namespace Xyce {
+namespace Linear {
+
+//-----------------------------------------------------------------------------
+// Class         : SparseLU
+// Purpose       : PA = LU of a square sparse matrix, factors held in Scalar.
+// Special Notes : L is unit lower triangular with the diagonal stored first
+//                 in each column, U has the pivot stored last in each column.
+//                 The entries of each column of U are kept in the order of
+//                 the sparse triangular solve, so refactor() can replay it
+//                 with the same pivots and pattern.
+// Creator       :
+// Creation Date :
+//-----------------------------------------------------------------------------
+template <typename Scalar>
+class SparseLU
+{
+public:
+  SparseLU(double pivot_tol = 0.001)
+    : pivotTol_(pivot_tol),
+      n_(0),
+      factored_(false)
+  {}
+
+  bool isFactored() const
+  {
+    return factored_;
+  }
+
+  int size() const
+  {
+    return n_;
+  }
+
+  // Number of nonzeros in L and U.  Each takes an int index and a Scalar value,
+  // so float factors need about two thirds of the memory of double factors.
+  std::size_t numNonzeros() const
+  {
+    return Li_.size() + Ui_.size();
+  }
+
+  int factor(int n, const int * colptr, const int * rowind, const double * values);
+
+  int refactor(const int * colptr, const int * rowind, const double * values);
+
+  void solve(double * b, bool transpose = false) const;
+
+private:
+  int reach_(const int * colptr, const int * rowind, int k);
+
+private:
+  double                pivotTol_;
+  int                   n_;
+  bool                  factored_;
+
+  std::vector<int>      Lp_;
+  std::vector<int>      Li_;
+  std::vector<Scalar>   Lx_;
+  std::vector<int>      Up_;
+  std::vector<int>      Ui_;
+  std::vector<Scalar>   Ux_;
+  std::vector<int>      pinv_;
+
+  // Work space
+  std::vector<Scalar>   x_;
+  std::vector<int>      xi_;
+  std::vector<int>      stack_;
+  std::vector<int>      pstack_;
+  std::vector<char>     mark_;
+  mutable std::vector<Scalar> work_;
+};
+
+//-----------------------------------------------------------------------------
+// Function      : SparseLU::reach_
+// Purpose       : Nonzero pattern of L \ A(:,k), in topological order.
+// Special Notes : Returns top, the pattern is xi_[top..n-1].  Depth first
+//                 search through the columns of L factored so far, using an
+//                 explicit stack.  Rows that are not yet pivotal have no
+//                 column in L and end the search.
+// Scope         : private
+// Creator       :
+// Creation Date :
+//-----------------------------------------------------------------------------
+template <typename Scalar>
+int SparseLU<Scalar>::reach_(const int * colptr, const int * rowind, int k)
+{
+  int top = n_;
+  for (int p = colptr[k]; p < colptr[k+1]; ++p)
+  {
+    if (mark_[rowind[p]])
+      continue;
+
+    int head = 0;
+    stack_[0] = rowind[p];
+    while (head >= 0)
+    {
+      int j = stack_[head];
+      int jnew = pinv_[j];
+      if (!mark_[j])
+      {
+        mark_[j] = 1;
+        pstack_[head] = (jnew < 0) ? 0 : Lp_[jnew] + 1;
+      }
+
+      bool done = true;
+      int pend = (jnew < 0) ? 0 : Lp_[jnew+1];
+      for (int q = pstack_[head]; q < pend; ++q)
+      {
+        int i = Li_[q];
+        if (mark_[i])
+          continue;
+        pstack_[head] = q;
+        stack_[++head] = i;
+        done = false;
+        break;
+      }
+
+      if (done)
+      {
+        --head;
+        xi_[--top] = j;
+      }
+    }
+  }
+
+  for (int p = top; p < n_; ++p)
+    mark_[xi_[p]] = 0;
+
+  return top;
+}
+
+//-----------------------------------------------------------------------------
+// Function      : SparseLU::factor
+// Purpose       : Symbolic and numeric factorization with pivoting.
+// Special Notes : Returns 0 on success, or k+1 if column k has no usable
+//                 pivot.
+// Scope         : public
+// Creator       :
+// Creation Date :
+//-----------------------------------------------------------------------------
+template <typename Scalar>
+int SparseLU<Scalar>::factor(int n, const int * colptr, const int * rowind, const double * values)
+{
+  n_ = n;
+  factored_ = false;
+
+  Lp_.assign(n+1, 0);
+  Up_.assign(n+1, 0);
+  Li_.clear(); Lx_.clear();
+  Ui_.clear(); Ux_.clear();
+  pinv_.assign(n, -1);
+
+  x_.assign(n, Scalar(0));
+  xi_.resize(n);
+  stack_.resize(n);
+  pstack_.resize(n);
+  mark_.assign(n, 0);
+  work_.resize(n);
+
+  for (int k = 0; k < n; ++k)
+  {
+    Lp_[k] = Li_.size();
+    Up_[k] = Ui_.size();
+
+    // x = L \ A(:,k), over the pattern found by reach_.  L holds the
+    // original row indices until the end of the factorization.
+    int top = reach_(colptr, rowind, k);
+    for (int p = colptr[k]; p < colptr[k+1]; ++p)
+      x_[rowind[p]] = values[p];
+
+    for (int px = top; px < n; ++px)
+    {
+      int j = xi_[px];
+      int J = pinv_[j];
+      if (J < 0)
+        continue;
+      Scalar xj = x_[j];
+      for (int q = Lp_[J] + 1; q < Lp_[J+1]; ++q)
+        x_[Li_[q]] -= Lx_[q]*xj;
+    }
+
+    // Split into U(:,k) and the candidates for the pivot.
+    int ipiv = -1;
+    double a = -1.0;
+    for (int px = top; px < n; ++px)
+    {
+      int i = xi_[px];
+      if (pinv_[i] < 0)
+      {
+        double t = std::fabs(static_cast<double>(x_[i]));
+        if (t > a)
+        {
+          a = t;
+          ipiv = i;
+        }
+      }
+      else
+      {
+        Ui_.push_back(pinv_[i]);
+        Ux_.push_back(x_[i]);
+      }
+    }
+
+    if (ipiv < 0 || a <= 0.0)
+    {
+      for (int px = top; px < n; ++px)
+        x_[xi_[px]] = Scalar(0);
+      return k+1;
+    }
+
+    if (pinv_[k] < 0 && std::fabs(static_cast<double>(x_[k])) >= a*pivotTol_)
+      ipiv = k;
+
+    Scalar pivot = x_[ipiv];
+    Ui_.push_back(k);
+    Ux_.push_back(pivot);
+    pinv_[ipiv] = k;
+
+    Li_.push_back(ipiv);
+    Lx_.push_back(Scalar(1));
+    for (int px = top; px < n; ++px)
+    {
+      int i = xi_[px];
+      if (pinv_[i] < 0)
+      {
+        Li_.push_back(i);
+        Lx_.push_back(x_[i]/pivot);
+      }
+      x_[i] = Scalar(0);
+    }
+  }
+
+  Lp_[n] = Li_.size();
+  Up_[n] = Ui_.size();
+
+  // Row indices of L in pivotal order, like those of U.
+  for (std::size_t p = 0; p < Li_.size(); ++p)
+    Li_[p] = pinv_[Li_[p]];
+
+  factored_ = true;
+  return 0;
+}
+
+//-----------------------------------------------------------------------------
+// Function      : SparseLU::refactor
+// Purpose       : Numeric factorization reusing the pivots and the pattern of
+//                 the last call to factor().
+// Special Notes : The matrix must have the pattern it had in factor().
+//                 Returns nonzero if a pivot has become too small relative
+//                 to its column, in which case factor() should be called.
+// Scope         : public
+// Creator       :
+// Creation Date :
+//-----------------------------------------------------------------------------
+template <typename Scalar>
+int SparseLU<Scalar>::refactor(const int * colptr, const int * rowind, const double * values)
+{
+  if (!factored_)
+    return 1;
+
+  factored_ = false;
+  for (int k = 0; k < n_; ++k)
+  {
+    for (int p = colptr[k]; p < colptr[k+1]; ++p)
+      x_[pinv_[rowind[p]]] = values[p];
+
+    // Replay the triangular solve in the stored order of U(:,k).
+    int udiag = Up_[k+1] - 1;
+    for (int p = Up_[k]; p < udiag; ++p)
+    {
+      int j = Ui_[p];
+      Scalar xj = x_[j];
+      Ux_[p] = xj;
+      x_[j] = Scalar(0);
+      for (int q = Lp_[j] + 1; q < Lp_[j+1]; ++q)
+        x_[Li_[q]] -= Lx_[q]*xj;
+    }
+
+    Scalar pivot = x_[k];
+    x_[k] = Scalar(0);
+
+    double a = 0.0;
+    for (int q = Lp_[k] + 1; q < Lp_[k+1]; ++q)
+      a = std::max(a, static_cast<double>(std::fabs(x_[Li_[q]])));
+
+    if (pivot == Scalar(0) || std::fabs(static_cast<double>(pivot)) < a*pivotTol_)
+    {
+      for (int q = Lp_[k] + 1; q < Lp_[k+1]; ++q)
+        x_[Li_[q]] = Scalar(0);
+      return k+1;
+    }
+
+    Ux_[udiag] = pivot;
+    for (int q = Lp_[k] + 1; q < Lp_[k+1]; ++q)
+    {
+      Lx_[q] = x_[Li_[q]]/pivot;
+      x_[Li_[q]] = Scalar(0);
+    }
+  }
+
+  factored_ = true;
+  return 0;
+}
+
+//-----------------------------------------------------------------------------
+// Function      : SparseLU::solve
+// Purpose       : Overwrite b with A \ b, or with A^T \ b.
+// Special Notes : The solve is carried out in Scalar.
+// Scope         : public
+// Creator       :
+// Creation Date :
+//-----------------------------------------------------------------------------
+template <typename Scalar>
+void SparseLU<Scalar>::solve(double * b, bool transpose) const
+{
+  if (transpose)
+  {
+    // A^T = U^T L^T P, so solve with U^T and L^T, then undo the pivoting.
+    for (int j = 0; j < n_; ++j)
+    {
+      int udiag = Up_[j+1] - 1;
+      Scalar xj = static_cast<Scalar>(b[j]);
+      for (int p = Up_[j]; p < udiag; ++p)
+        xj -= Ux_[p]*work_[Ui_[p]];
+      work_[j] = xj/Ux_[udiag];
+    }
+
+    for (int j = n_ - 1; j >= 0; --j)
+    {
+      Scalar xj = work_[j];
+      for (int p = Lp_[j] + 1; p < Lp_[j+1]; ++p)
+        xj -= Lx_[p]*work_[Li_[p]];
+      work_[j] = xj;
+    }
+
+    for (int i = 0; i < n_; ++i)
+      b[i] = static_cast<double>(work_[pinv_[i]]);
+
+    return;
+  }
+
+  for (int i = 0; i < n_; ++i)
+    work_[pinv_[i]] = static_cast<Scalar>(b[i]);
+
+  for (int j = 0; j < n_; ++j)
+  {
+    Scalar xj = work_[j];
+    for (int p = Lp_[j] + 1; p < Lp_[j+1]; ++p)
+      work_[Li_[p]] -= Lx_[p]*xj;
+  }
+
+  for (int j = n_ - 1; j >= 0; --j)
+  {
+    int udiag = Up_[j+1] - 1;
+    work_[j] /= Ux_[udiag];
+    Scalar xj = work_[j];
+    for (int p = Up_[j]; p < udiag; ++p)
+      work_[Ui_[p]] -= Ux_[p]*xj;
+  }
+
+  for (int i = 0; i < n_; ++i)
+    b[i] = static_cast<double>(work_[i]);
+}
+
+} // namespace Linear
+} // namespace Xyce
+
+#endif // Xyce_N_LAS_SparseLU_h
@@ -0,0 +1,163 @@
+//-------------------------------------------------------------------------
+//   Copyright 2002-2024 National Technology & Engineering Solutions of
+//   Sandia, LLC (NTESS).  Under the terms of Contract DE-NA0003525 with
+//   NTESS, the U.S. Government retains certain rights in this software.
+//
+//   This file is part of the Xyce(TM) Parallel Electrical Simulator.
+//
+//   Xyce(TM) is free software: you can redistribute it and/or modify
+//   it under the terms of the GNU General Public License as published by
+//   the Free Software Foundation, either version 3 of the License, or
+//   (at your option) any later version.
+//
+//   Xyce(TM) is distributed in the hope that it will be useful,
+//   but WITHOUT ANY WARRANTY; without even the implied warranty of
+//   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//   GNU General Public License for more details.
+//
+//   You should have received a copy of the GNU General Public License
+//   along with Xyce(TM).
+//   If not, see <http://www.gnu.org/licenses/>.
+//-------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+//
+// Purpose        : Shared memory direct linear solver that factors the
+//                  diagonal blocks of a block triangular matrix concurrently.
+//
+// Special Notes  : The BTF ordering itself comes from TransformTool, this
+//                  solver only finds the resulting diagonal blocks.
+//
+// Creator        :
+//
+// Creation Date  :
+//
+//-----------------------------------------------------------------------------
+
+#ifndef Xyce_N_LAS_ThreadedLUSolver_h
+#define Xyce_N_LAS_ThreadedLUSolver_h
+
+#include <vector>
+
+#include <N_LAS_fwd.h>
+#include <N_UTL_fwd.h>
+
+#include <N_LAS_Solver.h>
+#include <N_LAS_SparseLU.h>
+#include <N_LAS_TransformTool.h>
+#include <Teuchos_RCP.hpp>
+
+class Epetra_LinearProblem;
+class Epetra_CrsMatrix;
+
+namespace Xyce {
+namespace Linear {
+
+//-----------------------------------------------------------------------------
+// Class         : ThreadedLUSolver
+// Purpose       : Direct solver for TYPE=THREADEDLU.
+// Special Notes : Serial only.  The diagonal blocks are factored by SparseLU,
+//                 using OpenMP threads when Xyce is built with OpenMP.
+// Creator       :
+// Creation Date :
+//-----------------------------------------------------------------------------
+class ThreadedLUSolver : public Solver
+{
+
+public:
+  // Constructor
+  ThreadedLUSolver(
+    Problem &                   problem,
+    Util::OptionBlock &         options);
+
+  // Destructor
+  ~ThreadedLUSolver();
+
+  // Set the solver options
+  bool setOptions(const Util::OptionBlock & OB);
+  bool setDefaultOptions();
+
+  // Set individual options
+  bool setParam( const Util::Param & param );
+
+  // Get info such as Num Iterations, Residual, etc.
+  bool getInfo( Util::Param & info );
+
+  // Solve function: x = A^(-1) b.
+  // input parameter 'ReuseFactors': If 'true', do not factor A, rather reuse
+  // factors from previous solve.  Useful for inexact nonlinear techniques and
+  // multiple RHS solves.
+  int doSolve( bool reuse_factors, bool transpose = false );
+
+private:
+
+  // Find the diagonal blocks and order each of them.
+  bool analyze_( const Epetra_CrsMatrix & A );
+
+  // Copy the values of A into the blocks, returns true if the pattern changed.
+  bool extractValues_( const Epetra_CrsMatrix & A );
+
+  // Check if A has the pattern the block structure was built for.
+  bool samePattern_( const Epetra_CrsMatrix & A ) const;
+
+  // Numeric factorization of all the diagonal blocks.
+  int factor_();
+
+  // Block back (or forward, for the transpose) substitution, in place.
+  void solveBlocks_( double * x, bool transpose ) const;
+
+private:
+
+  //Primary problem access
+  Epetra_LinearProblem * problem_;
+
+  //Repivot every time or reuse the pivots of the last factorization
+  bool repivot_;
+
+  //Output the linear system on a failed factorization
+  int outputFailedLS_;
+
+  // Transform Support
+  Teuchos::RCP<Transform> transform_;
+  Epetra_LinearProblem * tProblem_;
+
+  //Options
+  Util::OptionBlock * options_;
+
+  //Timer
+  Util::Timer * timer_;
+
+  // Block structure, kept for as long as the pattern of the matrix does not change.
+  int n_;
+  int nnz_;
+  bool factored_;
+  std::vector<int> blockPtr_;
+  std::vector<int> blockOrder_;
+  std::vector<int> newIndex_;
+  std::vector<int> colToDomain_;
+  std::vector<int> entryDest_;
+
+  // Pattern of A the block structure was built for, by row.
+  std::vector<int> rowPtr_;
+  std::vector<int> colInd_;
+
+  // Diagonal blocks in compressed column form, row indices local to the block.
+  std::vector<int> diagColPtr_;
+  std::vector<int> diagRowInd_;
+  std::vector<double> diagValues_;
+
+  // Entries outside of the diagonal blocks, by row.
+  std::vector<int> offRowPtr_;
+  std::vector<int> offColInd_;
+  std::vector<double> offValues_;
+
+  // Factors of the blocks larger than 1x1.
+  std::vector<Teuchos::RCP<SparseLU<double> > > blockLU_;
+
+  std::vector<double> work_;
+};
+
+} // namespace Linear
+} // namespace Xyce
+
+#endif // Xyce_N_LAS_ThreadedLUSolver_h
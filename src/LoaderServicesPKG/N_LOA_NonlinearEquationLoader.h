@@ -89,6 +89,11 @@ public:
   // // Method which is called to load the nonlinear residual (RHS) vector.
   bool loadRHS();
 
+  // Apply the Jacobian by finite differences of the DAE vectors when the
+  // loader cannot apply its matrices (.OPTIONS NONLIN MATRIXFREE).
+  void setFDJacobianFlag (bool flag) { fdJacobianFlag_ = flag; }
+  bool getFDJacobianFlag () const { return fdJacobianFlag_; }
+
   void setSeparateLoadFlag (bool flag);
   bool getSeparateLoadFlag ();
 
@@ -203,6 +208,11 @@ public:
 
   virtual void resetScaledParams();
 
+private:
+  bool applyDAEMatricesFD_(const Linear::Vector & input);
+  bool loadPerturbedDAEVectors_(double h, const Linear::Vector & input, Linear::Vector & Q, Linear::Vector & F);
+  bool loadFDBaseVectors_(const Linear::Vector & input);
+
 private:
   Util::Timer * residualTimerPtr_;
   Util::Timer * jacobianTimerPtr_;
@@ -213,6 +223,22 @@ private:
   Loader &                              loader_;
   TimeIntg::WorkingIntegrationMethod &  wim_;
   Device::DeviceMgr &                   deviceManager_; ///< Device manager
+
+  // Work vectors for the finite difference Jacobian apply
+  bool                                  fdJacobianFlag_;
+  bool                                  fdBaseValid_;
+  Linear::Vector *                      fdSolutionPtr_;
+  Linear::Vector *                      fdStatePtr_;
+  Linear::Vector *                      fdStateDerivPtr_;
+  Linear::Vector *                      fdStorePtr_;
+  Linear::Vector *                      fdLeadCurrentPtr_;
+  Linear::Vector *                      fdLeadCurrentQPtr_;
+  Linear::Vector *                      fdLeadDeltaVPtr_;
+  Linear::Vector *                      fdQVectorPtr_;
+  Linear::Vector *                      fdFVectorPtr_;
+  Linear::Vector *                      fdBVectorPtr_;
+  Linear::Vector *                      fdFdxdVpVectorPtr_;
+  Linear::Vector *                      fdQdxdVpVectorPtr_;
 };
 
 } // namespace Loader
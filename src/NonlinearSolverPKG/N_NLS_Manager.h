@@ -172,6 +172,11 @@ public:
     matrixFreeFlag_ = matrixFreeFlag;
   }
 
+  bool getMatrixFreeFlag() const
+  {
+    return matrixFreeFlag_;
+  }
+
   void allocateTranSolver(
     Analysis::AnalysisManager &         analysis_manager,
     Loader::NonlinearEquationLoader &   nonlinear_equation_loader, 
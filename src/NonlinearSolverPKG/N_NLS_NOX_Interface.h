@@ -40,6 +40,9 @@
 #ifndef Xyce_N_NLS_NOX_Interface_h
 #define Xyce_N_NLS_NOX_Interface_h
 
+#include <iosfwd>
+#include <vector>
+
 #include <N_IO_fwd.h>
 #include <N_LOA_fwd.h>
 #include <N_PDS_fwd.h>
@@ -90,6 +93,8 @@ namespace N_NLS_NOX {
       int solve (Xyce::Nonlinear::NonLinearSolver * nlsTmpPtr = NULL);
 
       int spiceStrategy ( ParameterSet* paramsPtr );
+      int dcopFallbackSolve ( ParameterSet* paramsPtr, int solverType, const Xyce::Linear::Vector & initVec );
+      void printDCOPFallbackStats (std::ostream & os) const;
 
       int stdNewtonSolve ( ParameterSet* paramsPtr );
       int naturalParameterContinuationSolve ( ParameterSet* paramsPtr );
@@ -222,6 +227,27 @@ namespace N_NLS_NOX {
 
       //parameter index
       int iParam_;
+
+      // Statistics for the DCOP fallback strategies that spiceStrategy
+      // tries after the standard Newton solve fails.
+      struct DCOPFallback
+      {
+        DCOPFallback(const char * name, int solver_type)
+          : name_(name),
+            solverType_(solver_type),
+            attempts_(0),
+            successes_(0),
+            time_(0.0)
+        {}
+
+        const char *    name_;
+        int             solverType_;
+        int             attempts_;
+        int             successes_;
+        double          time_;
+      };
+
+      std::vector<DCOPFallback> dcopFallbacks_;
   };
 
 }}} // namespace N_NLS_NOX
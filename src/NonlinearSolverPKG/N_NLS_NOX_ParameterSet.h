@@ -110,6 +110,16 @@ public:
     return continuationSpecified_;
   }
 
+  bool getAdaptiveDCOPFlag () const
+  {
+    return adaptiveDCOP_;
+  }
+
+  bool getDCOPStatsFlag () const
+  {
+    return dcopStats_;
+  }
+
   inline int  getDebugLevel() const
   {
     return debugLevel_;
@@ -192,6 +202,8 @@ private:
   bool isStatusTestsSet_;
 
   bool continuationSpecified_;
+  bool adaptiveDCOP_;
+  bool dcopStats_;
 
   Xyce::Nonlinear::AnalysisMode mode_;
 
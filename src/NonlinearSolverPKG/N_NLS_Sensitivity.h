@@ -203,6 +203,11 @@ private:
   Linear::Vector * savedRHSVectorPtr_;
   Linear::Vector * savedNewtonVectorPtr_;
 
+  // The direct sensitivity right hand sides, and solutions, other than the
+  // first, for when the first one is solved while factoring the Jacobian.
+  Linear::MultiVector * restRHSPtrVector_;
+  Linear::MultiVector * restDXdpPtrVector_;
+
   NonLinearSolver * nls_;
 
   Topo::Topology & top_;
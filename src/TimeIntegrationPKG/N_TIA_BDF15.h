@@ -0,0 +1,136 @@
+//-------------------------------------------------------------------------
+//   Copyright 2002-2024 National Technology & Engineering Solutions of
+//   Sandia, LLC (NTESS).  Under the terms of Contract DE-NA0003525 with
+//   NTESS, the U.S. Government retains certain rights in this software.
+//
+//   This file is part of the Xyce(TM) Parallel Electrical Simulator.
+//
+//   Xyce(TM) is free software: you can redistribute it and/or modify
+//   it under the terms of the GNU General Public License as published by
+//   the Free Software Foundation, either version 3 of the License, or
+//   (at your option) any later version.
+//
+//   Xyce(TM) is distributed in the hope that it will be useful,
+//   but WITHOUT ANY WARRANTY; without even the implied warranty of
+//   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//   GNU General Public License for more details.
+//
+//   You should have received a copy of the GNU General Public License
+//   along with Xyce(TM).
+//   If not, see <http://www.gnu.org/licenses/>.
+//-------------------------------------------------------------------------
+
+
+//-----------------------------------------------------------------------------
+//
+// Purpose       : This file defines the classes for the variable-order,
+//                 variable-step backward differentiation method, orders 1-5.
+//
+// Special Notes : The history is kept as solution values, as in Gear12
+//                 (xHistory[i] = x_{n-i}), so the method
+//                 coefficients are recomputed from the step-size history
+//                 (sec.psi_) on every step.
+//
+// Creator       :
+//
+// Creation Date :
+//
+//
+//
+//
+//-----------------------------------------------------------------------------
+
+#ifndef Xyce_N_TIA_BDF15_H
+#define Xyce_N_TIA_BDF15_H
+
+// ---------- Standard Includes ----------
+
+// ----------   Xyce Includes   ----------
+#include <N_TIA_Gear12.h>
+
+namespace Xyce {
+namespace TimeIntg {
+
+//-----------------------------------------------------------------------------
+// Class         : BDF15
+// Purpose       : Variable-order BDF Formula Integration Class
+//                (derived from Gear12)
+// Special Notes : The order is chosen after each successful step by
+//                 comparing the step-size predicted by the error estimates
+//                 at orders k-1, k and k+1.  The order is reset to minOrder
+//                 at breakpoints and after Newton failures, as in Gear12.
+//
+//                 The sensitivity residuals are inherited from Gear12, so
+//                 the order is capped at 2 when sensitivities are computed.
+// Creator       :
+// Creation Date :
+//-----------------------------------------------------------------------------
+class BDF15 : public Gear12
+{
+public:
+  static const int type = Xyce::TimeIntg::methodsEnum::BDF;
+  static const char *name;
+
+  static TimeIntegrationMethod *factory(const TIAParams &tia_params, StepErrorControl &step_error_control, DataStore &data_store);
+
+  BDF15(
+    const TIAParams &   tia_params,
+    StepErrorControl &  step_error_control,
+    DataStore &         data_store);
+
+  ~BDF15()
+  {}
+
+  const char *getName() const {
+    return "BDF 15";
+  }
+
+  int getMethod() const
+  {
+    return type;
+  }
+
+  void updateStateDeriv();
+
+  // calculates dQ/dt component of lead current Q vector and adds it to the lead current vector
+  void updateLeadCurrentVec();
+
+  // Evaluate corrector residual for nonlinear solver
+  void obtainResidual();
+
+  // Update history array after a successful step
+  void updateHistory();
+
+  // Restore history array after a failed step
+  void restoreHistory();
+
+  // Update method coefficients
+  void updateCoeffs();
+
+  // Interpolate solution approximation at prescribed time point.
+  bool interpolateSolution(double timepoint, Linear::Vector * tmpSolVectorPtr, std::vector<Linear::Vector*> & historyVec);
+
+  // Initialize method with initial solution & step-size
+  void initialize(const TIAParams &tia_params);
+
+  // Complete a step(this updates history and chooses new order & step-size)
+  void completeStep(const TIAParams &tia_params);
+
+  // Restart methods.
+  bool getSolnVarData( const int & gid, std::vector<double> & varData );
+  bool setSolnVarData( const int & gid, const std::vector<double> & varData );
+
+private:
+  // Estimate the scaled local error of the accepted step at another order.
+  double errorEstimateAtOrder(int order);
+
+  // Choose the order for the next step.
+  int selectOrder(double & rr);
+
+  int                   stepsAtOrder_;  ///< Number of steps taken since the last order change.
+};
+
+} // namespace TimeIntg
+} // namespace Xyce
+
+#endif     //Xyce_N_TIA_BDF15_H
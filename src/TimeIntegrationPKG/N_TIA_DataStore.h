@@ -41,6 +41,9 @@
 #define Xyce_N_TIA_DataStore_h
 
 // ---------- Standard Includes ----------
+#include <fstream>
+#include <set>
+#include <string>
 #include <vector>
 
 // ----------   Xyce Includes   ----------
@@ -82,7 +85,7 @@ class DataStore
   // DataStore Functions
   public:
 
-    void updateSolDataArrays();
+    void updateSolDataArrays(bool copyNextSolution = true);
     bool updateStateDataArrays();
     void updateSolDataArraysAdjoint (int timeIndex);
 
@@ -91,14 +94,33 @@ class DataStore
     void setZeroHistory();
     void setConstantHistoryAdjoint ();
 
+    // Forward history for transient adjoints.  Entries beyond the resident
+    // limit are spilled to a scratch file and paged back in on demand.
+    void setAdjointHistoryLimit(int max_resident, const std::string & spill_file);
+    void saveAdjointHistory();
+    void clearAdjointHistory();
+
+    Linear::Vector & getSolutionHistory(int i) { recallAdjointHistory(i); return *solutionHistory[i]; }
+    Linear::Vector & getStateHistory(int i) { recallAdjointHistory(i); return *stateHistory[i]; }
+    Linear::Vector & getStoreHistory(int i) { recallAdjointHistory(i); return *storeHistory[i]; }
+
     void setErrorWtVector(const TIAParams &tia_params, const std::vector<char> &     variable_type);
     double WRMS_errorNorm();
+    double WRMS_predictorErrorNorm(const std::vector<double> & beta, int order);
+
+    void computePredictor(const std::vector<double> & beta, int order, bool extrapolateQ);
 
     bool equateTmpVectors ();
     bool usePreviousSolAsPredictor ();
 
     void stepLinearCombo ();
 
+    // Subcircuit partition latency monitoring
+    void setPartitions(const std::vector<std::string> & names, const std::vector<int> & partition_of_lid);
+    int getNumPartitions() const { return partitionNames_.size(); }
+    const std::vector<std::string> & getPartitionNames() const { return partitionNames_; }
+    double partitionErrorNorms(std::vector<double> & norms);
+
     double partialErrorNormSum();
     double partialQErrorNormSum();
 
@@ -300,6 +322,7 @@ class DataStore
     std::vector< int > orderHistory;
     std::vector< double > dtHistory;
     std::vector< double > timeHistory;
+    // entries are null while spilled; use the get*History accessors.
     std::vector< Linear::Vector *> solutionHistory;
     std::vector< Linear::Vector *> stateHistory;
     std::vector< Linear::Vector *> storeHistory;
@@ -339,8 +362,23 @@ class DataStore
     std::vector<double> paramOrigVals_; 
 
   private:
+    void spillAdjointHistory(int i);
+    void recallAdjointHistory(int i);
+
     bool nextSolPtrSwitched_;
 
+    // Local sums of the weighted x and q newton corrections, computed in
+    // stepLinearCombo and reduced by WRMS_errorNorm.
+    bool errorSumsValid_;
+    double localErrorSums_[2];
+    bool errWtVecSet_;
+
+    // Partition of the owned solution entries (-1 for none), and the global
+    // number of entries in each partition.
+    std::vector<std::string> partitionNames_;
+    std::vector<int> partitionOfLID_;
+    std::vector<double> partitionSizes_;
+
     std::vector<int> indexIVars;
     std::vector<int> indexVVars;
     std::vector<int> indexMaskedVars;
@@ -356,6 +394,13 @@ class DataStore
     bool allocateSensitivityArraysComplete_;
     bool includeTransientAdjoint_;
     bool includeTransientDirect_;
+
+    // Adjoint history paging.  Zero resident limit means keep everything.
+    int adjointHistoryLimit_;
+    std::string adjointSpillFile_;
+    std::fstream adjointSpillStream_;
+    std::vector<char> adjointSpilled_;
+    std::set<int> adjointResident_;
 };
 
 } // namespace TimeIntg
@@ -203,6 +203,9 @@ public:
   // Evaluate corrector Jacobian for nonlinear solver
   void obtainJacobian();
 
+  // Apply Jacobian for nonlinear solver
+  void applyJacobian(const Linear::Vector& input, Linear::Vector& result);
+
   // Update history array after a successful step
   void updateHistory();
 
@@ -253,7 +256,7 @@ public:
   bool getStoreVarData( const int & gid, std::vector<double> & varData ); 
   bool setStoreVarData( const int & gid, const std::vector<double> & varData ); 
  
-private:
+protected:
   // Interpolate MPDE solution approximation at prescribed time point.
   bool interpolateMPDESolution(std::vector<double>& timepoint, Linear::Vector * tmpSolVectorPtr);
 
@@ -207,6 +207,9 @@ public:
   // Evaluate corrector Jacobian for nonlinear solver
   void obtainJacobian();
 
+  // Apply Jacobian for nonlinear solver
+  void applyJacobian(const Linear::Vector& input, Linear::Vector& result);
+
   // Update history array after a successful step 
   void updateHistory();
 
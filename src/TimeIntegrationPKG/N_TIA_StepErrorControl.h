@@ -83,6 +83,7 @@ namespace TimeIntg {
 class StepErrorControl
 {
   friend class Gear12;
+  friend class BDF15;
   friend class OneStep;
 
   public:
@@ -187,6 +188,9 @@ class StepErrorControl
 
   int getCurrentOrder() { return currentOrder_; }
 
+  // Print the latency of each subcircuit partition.
+  void outputPartitionLatency(std::ostream &os) const;
+
   private:
   bool initializeBreakPoints(double start_time, double initial_time, double final_time);
 
@@ -196,6 +200,8 @@ class StepErrorControl
 
   void terseIntegrationStepReport(std::ostream &os, bool step_attempt_status, bool sAStatus, bool testedError, const TIAParams &tia_params);
 
+  void updatePartitionLatency(const TIAParams &tia_params);
+
 
   // member data:
   private:
@@ -302,6 +308,11 @@ class StepErrorControl
 
   int maxNumfail_;        // max number of error test failure
   bool reportedPauseBP;   // true if any devices have produced pause breakpoints.
+
+  // Subcircuit partition latency monitoring (TIAParams::latencyReport)
+  int partitionSteps_;                        // number of accepted steps that were monitored
+  std::vector<int> partitionLatentSteps_;     // accepted steps on which each partition was latent
+  std::vector<double> partitionLogRatioSum_;  // sum of the log of the step-size ratio each partition allows
 };
 
 //-----------------------------------------------------------------------------
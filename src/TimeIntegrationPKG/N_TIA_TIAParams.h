@@ -120,6 +120,14 @@ public:
   bool maskIVars;
   int newLte;
 
+  bool          latencyReport;                  ///< Monitor the step-size demand of each top-level subcircuit
+  double        latentRatio;                    ///< Step-size ratio above which a subcircuit counts as latent
+
+  int           opCache;                        ///< Seed the operating point from earlier .STEP iterations (Analysis::OPCache::Mode)
+  int           opCacheSize;                    ///< Maximum number of cached operating points
+
+  bool          dcPredictor;                    ///< Extrapolate the starting guess of each .DC sweep point
+
   // Error Tolerances:
 
     // Relative error tolerance.  This value should be selected to be 10^(-(m+1))
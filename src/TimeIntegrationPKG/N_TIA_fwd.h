@@ -55,7 +55,7 @@ class WorkingIntegrationMethod;
 // statements like ".options timeint method=7".
 enum methodsEnum {
   NO_TIME_INTEGRATION, OBSOLETE1, OBSOLETE2, OBSOLETE3, OBSOLETE4, OBSOLETE5, OBSOLETE6,
-  ONESTEP, GEAR};
+  ONESTEP, GEAR, BDF};
 
 } // namespace TimeIntg
 } // namespace Xyce
@@ -144,11 +144,24 @@ public:
   // write out the circuit graph to the ostream
   void streamCircuitGraph(std::ostream & os);
 
+private:
+  // Builds the compressed row storage form of the graph in BFSNodeList_ order
+  void buildCSRGraph_( const std::vector<int> & bfsVec );
+
 private:
   Graph                 cktgph_;                ///< Circuit graph pair = <id, node type>, CktNode = data
   CktNodeList           BFSNodeList_;           ///< List of ckt nodes in breadth-first traversal order.
   bool                  isModified_;            ///< Don't update traversals if not modified - flag.
 
+  // Immutable compressed row storage copy of the graph, rebuilt with BFSNodeList_.
+  // Rows and columns are positions in BFSNodeList_, so adjacent ckt nodes are
+  // found without going through the graph's hashed key and data maps.
+  std::vector<int>              csrRowPtr_;             ///< Row offsets into csrColIdx_, size BFSNodeList_.size()+1
+  std::vector<int>              csrColIdx_;             ///< Adjacent node positions in BFSNodeList_
+  std::vector<int>              csrGraphIndex_;         ///< Graph index of each position in BFSNodeList_
+  std::vector<int>              devNodeRows_;           ///< Positions of the device nodes in BFSNodeList_
+  std::vector<CktNode_Dev *>    devNodeList_;           ///< Device nodes in BFSNodeList_ order
+
   unordered_map<int,int>     indexToGID_;
   unordered_map<int,int>     gIDtoIndex_;
  
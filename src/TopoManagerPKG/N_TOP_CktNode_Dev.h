@@ -97,6 +97,11 @@ public:
     return deviceInstance_;
   }
 
+  Device::DeviceMgr &getDeviceManager() const
+  {
+    return *deviceManager_;
+  }
+
   // Get's the device state object.
   Device::DeviceState * getDevState();
 
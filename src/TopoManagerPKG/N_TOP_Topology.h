@@ -92,7 +92,7 @@ public:
   void registerGIDs();
 
   // Main call to register local id's with device instances.
-  void registerLIDswithDevs();
+  void registerLIDswithDevs(bool registerJacLIDs = true);
 
   // Resolution of Secondary Dependencies for devices.
   void resolveDependentVars();
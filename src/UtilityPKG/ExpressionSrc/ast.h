@@ -348,6 +348,9 @@ class astNode : public staticsContainer
     unsigned long int getId () { return id_; }
     virtual unsigned long int getNodeId () { return id_; }
 
+    // read-only access to the children.  Used by astProgram to lower the tree.
+    const std::vector<Teuchos::RCP<astNode<ScalarT> > > & getChildren() const { return childrenAstNodes_; }
+
     virtual void setupParents (Teuchos::RCP<astNode<ScalarT> > thisAst,
       std::unordered_map<unsigned long int, std::vector< std::pair< Teuchos::RCP<astNode<ScalarT> >, int > > > & astParents
         )
@@ -3337,6 +3340,11 @@ class funcOp: public astNode<ScalarT>
     bool getNodeResolved() { return nodeResolved_; }
     bool getArgsResolved() { return argsResolved_; }
 
+    // these are used by astProgram to inline the function body
+    Teuchos::RCP<astNode<ScalarT> > & getFunctionNode() { return functionNode_; }
+    std::vector< Teuchos::RCP<astNode<ScalarT> > > & getDummyFuncArgs() { return dummyFuncArgs_; }
+    bool getHasStateNodes() { return !(sdtNodes_.empty() && ddtNodes_.empty()); }
+
     virtual void processSuccessfulTimeStep ()
     {
       functionNode_->processSuccessfulTimeStep ();
@@ -0,0 +1,765 @@
+//-------------------------------------------------------------------------
+//   Copyright 2002-2024 National Technology & Engineering Solutions of
+//   Sandia, LLC (NTESS).  Under the terms of Contract DE-NA0003525 with
+//   NTESS, the U.S. Government retains certain rights in this software.
+//
+//   This file is part of the Xyce(TM) Parallel Electrical Simulator.
+//
+//   Xyce(TM) is free software: you can redistribute it and/or modify
+//   it under the terms of the GNU General Public License as published by
+//   the Free Software Foundation, either version 3 of the License, or
+//   (at your option) any later version.
+//
+//   Xyce(TM) is distributed in the hope that it will be useful,
+//   but WITHOUT ANY WARRANTY; without even the implied warranty of
+//   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//   GNU General Public License for more details.
+//
+//   You should have received a copy of the GNU General Public License
+//   along with Xyce(TM).
+//   If not, see <http://www.gnu.org/licenses/>.
+//-------------------------------------------------------------------------
+//-----------------------------------------------------------------------------
+//
+// Purpose        : Flat, register-based form of an expression AST.
+//
+// Special Notes  : The tree is lowered once into a linear list of
+//                  instructions.  Each instruction writes one register (its
+//                  own index), so evaluation is a single loop over a
+//                  contiguous value array, with the derivatives carried
+//                  along in forward mode.  Constant subtrees are folded and
+//                  identical subexpressions share a register.
+//
+//                  Only the arithmetic operators and the simple one-argument
+//                  functions are lowered.  Anything else becomes an "opaque"
+//                  leaf, which is evaluated by calling the node's own
+//                  val()/dx2() functions, so the result always matches the
+//                  tree walk.  Calls to .FUNCs are inlined when the body
+//                  can be lowered completely.
+//
+//                  The instruction list itself does not refer to the tree, 
+//                  (leaf instructions index into a per-program leaf array),
+//                  so structurally identical expressions, such as many 
+//                  B-sources with the same formula on different nodes, share
+//                  a single copy of it.  Programs that share code can be 
+//                  evaluated together with dx2Batch, which stores the 
+//                  registers lane-by-lane so the arithmetic for all of the
+//                  expressions runs as contiguous inner loops.
+//
+// Creator        :
+//
+// Creation Date  :
+//
+//-----------------------------------------------------------------------------
+
+#ifndef astProgram_H
+#define astProgram_H
+
+#include <functional>
+#include <map>
+#include <memory>
+#include <tuple>
+#include <unordered_map>
+#include <vector>
+#include <complex>
+
+#include <Teuchos_RCP.hpp>
+
+enum astProgramOpCode
+{
+  AST_PROG_CONST,
+  AST_PROG_LEAF,
+  AST_PROG_ADD,
+  AST_PROG_SUB,
+  AST_PROG_MUL,
+  AST_PROG_DIV,
+  AST_PROG_NEG,
+  AST_PROG_SQRT,
+  AST_PROG_EXP,
+  AST_PROG_ABS,
+  AST_PROG_SIN,
+  AST_PROG_COS,
+  AST_PROG_TAN,
+  AST_PROG_ATAN,
+  AST_PROG_SINH,
+  AST_PROG_COSH,
+  AST_PROG_TANH,
+  AST_PROG_LOG,
+  AST_PROG_LOG10
+};
+
+//-------------------------------------------------------------------------------
+// Class         : astProgram
+// Purpose       : compiled form of an AST
+// Special Notes : The program holds raw pointers into the AST it was compiled
+//                 from, so it has to be recompiled (or cleared) whenever that
+//                 AST changes.  newExpression takes care of this.
+// Creator       :
+// Creation Date :
+//-------------------------------------------------------------------------------
+template <typename ScalarT>
+class astProgram
+{
+  public:
+    astProgram () : root_(0), rootReg_(-1), numDerivs_(0), compiled_(false) {};
+
+    //-------------------------------------------------------------------------------
+    void clear()
+    {
+      program_.reset();
+      code_.clear();
+      leaves_.clear();
+      vals_.clear();
+      derivs_.clear();
+      cseMap_.clear();
+      leafPtrMap_.clear();
+      root_ = 0;
+      rootReg_ = -1;
+      numDerivs_ = 0;
+      compiled_ = false;
+    }
+
+    //-------------------------------------------------------------------------------
+    // Returns true if the program is worth using, ie. if the root of the tree
+    // is not itself an opaque leaf.
+    bool compile(const Teuchos::RCP<astNode<ScalarT> > & root)
+    {
+      clear();
+      if (Teuchos::is_null(root)) { return false; }
+
+      root_ = root.get();
+      std::unordered_map<astNode<ScalarT> *, int> noArgs;
+      rootReg_ = lower_(root_, noArgs, 0);
+
+      compiled_ = (rootReg_ >= 0) &&
+        !(code_[rootReg_].opCode == AST_PROG_LEAF && leaves_[code_[rootReg_].a] == root_);
+
+      if (compiled_) 
+      { 
+        // the lookup tables are only needed while lowering
+        cseMap_.clear();
+        leafPtrMap_.clear();
+        program_ = intern_(code_, rootReg_);
+        std::vector<instruction>().swap(code_);
+
+        const std::vector<instruction> & code = *program_;
+        vals_.resize(code.size(),0.0); 
+        for (int ii=0;ii<code.size();ii++)
+        {
+          if (code[ii].opCode == AST_PROG_CONST) { vals_[ii] = code[ii].value; }
+        }
+      }
+      else { clear(); root_ = root.get(); } // remember that this tree was tried
+
+      return compiled_;
+    }
+
+    bool isCompiled() const { return compiled_; }
+    bool isSetupFor(const Teuchos::RCP<astNode<ScalarT> > & root) const { return (root.get() == root_); }
+    int numInstructions() const { return compiled_ ? program_->size() : 0; }
+
+    // Programs with the same code id have identical instructions, and differ
+    // only in their leaves.  They can be evaluated together by dx2Batch.
+    const void * codeId() const { return program_.get(); }
+
+    //-------------------------------------------------------------------------------
+    ScalarT val()
+    {
+      const std::vector<instruction> & code = *program_;
+      const int size = code.size();
+      for (int ii=0;ii<size;ii++)
+      {
+        const instruction & in = code[ii];
+        switch (in.opCode)
+        {
+          case AST_PROG_CONST: break;
+          case AST_PROG_LEAF:  vals_[ii] = leaves_[in.a]->val(); break;
+          default:             vals_[ii] = apply_(in.opCode, vals_[in.a], (in.b>=0)?vals_[in.b]:ScalarT(0.0)); break;
+        }
+      }
+      return vals_[rootReg_];
+    }
+
+    //-------------------------------------------------------------------------------
+    // Same contract as astNode::dx2.  The derivative rules (including the 
+    // special treatment of numval operands) follow astbinary.h and astfuncs.h.
+    void dx2(ScalarT & result, std::vector<ScalarT> & derivs, int numDerivs)
+    {
+      const std::vector<instruction> & code = *program_;
+      if (numDerivs != numDerivs_)
+      {
+        numDerivs_ = numDerivs;
+        derivs_.assign(code.size()*numDerivs_, 0.0);
+        scratch_.assign(numDerivs_, 0.0);
+      }
+
+      const int size = code.size();
+      for (int ii=0;ii<size;ii++)
+      {
+        const instruction & in = code[ii];
+        ScalarT * d = numDerivs_ ? &(derivs_[ii*numDerivs_]) : 0;
+
+        if (in.opCode == AST_PROG_CONST) { continue; } // derivs stay zero
+        if (in.opCode == AST_PROG_LEAF)
+        {
+          leaves_[in.a]->dx2(vals_[ii], scratch_, numDerivs_);
+          for (int k=0;k<numDerivs_;k++) { d[k] = scratch_[k]; }
+          continue;
+        }
+
+        const ScalarT a = vals_[in.a];
+        const ScalarT * da = numDerivs_ ? &(derivs_[in.a*numDerivs_]) : 0;
+        const ScalarT * db = (numDerivs_ && in.b >= 0) ? &(derivs_[in.b*numDerivs_]) : 0;
+        const ScalarT b = (in.b >= 0) ? vals_[in.b] : ScalarT(0.0);
+
+        vals_[ii] = apply_(in.opCode, a, b);
+
+        switch (in.opCode)
+        {
+          case AST_PROG_ADD:
+            for (int k=0;k<numDerivs_;k++) 
+            { d[k] = (in.bConst)?(in.aConst?(0.0):(da[k])):(in.aConst?(db[k]):(da[k]+db[k])); }
+            break;
+          case AST_PROG_SUB:
+            for (int k=0;k<numDerivs_;k++) 
+            { d[k] = (in.bConst)?(in.aConst?(0.0):(da[k])):(in.aConst?(-db[k]):(da[k]-db[k])); }
+            break;
+          case AST_PROG_MUL:
+            for (int k=0;k<numDerivs_;k++) 
+            { d[k] = (in.bConst)?(in.aConst?(0.0):(da[k]*b)):(in.aConst?(db[k]*a):(da[k]*b+db[k]*a)); }
+            break;
+          case AST_PROG_DIV:
+            for (int k=0;k<numDerivs_;k++) 
+            { d[k] = (in.bConst)?(in.aConst?(0.0):((da[k]*b)/(b*b))):(in.aConst?((-db[k]*a)/(b*b)):((da[k]*b-db[k]*a)/(b*b))); }
+            break;
+          case AST_PROG_NEG:
+            for (int k=0;k<numDerivs_;k++) { d[k] = -da[k]; }
+            break;
+          case AST_PROG_SQRT:
+            for (int k=0;k<numDerivs_;k++) { d[k] = da[k]/(2.*std::sqrt(a)); }
+            break;
+          case AST_PROG_EXP:
+            for (int k=0;k<numDerivs_;k++) { d[k] = da[k]*std::exp(a); }
+            break;
+          case AST_PROG_ABS:
+            for (int k=0;k<numDerivs_;k++) { d[k] = (std::real(a) >= 0 ? da[k] : ScalarT(-da[k])); }
+            break;
+          case AST_PROG_SIN:
+            for (int k=0;k<numDerivs_;k++) { d[k] = da[k]*std::cos(a); }
+            break;
+          case AST_PROG_COS:
+            for (int k=0;k<numDerivs_;k++) { d[k] = -da[k]*std::sin(a); }
+            break;
+          case AST_PROG_TAN:
+            for (int k=0;k<numDerivs_;k++) { d[k] = da[k]*(1.+std::tan(a)*std::tan(a)); }
+            break;
+          case AST_PROG_ATAN:
+            for (int k=0;k<numDerivs_;k++) { d[k] = da[k]/(1.+a*a); }
+            break;
+          case AST_PROG_SINH:
+            for (int k=0;k<numDerivs_;k++) { d[k] = da[k]*std::cosh(a); }
+            break;
+          case AST_PROG_COSH:
+            for (int k=0;k<numDerivs_;k++) { d[k] = da[k]*std::sinh(a); }
+            break;
+          case AST_PROG_TANH:
+            if (std::real(a) <= 20 && std::real(a) >= -20)
+            {
+              ScalarT cosh_arg = std::cosh(a);
+              for (int k=0;k<numDerivs_;k++) { d[k] = (da[k]/(cosh_arg*cosh_arg)); }
+            }
+            else
+            {
+              for (int k=0;k<numDerivs_;k++) { d[k] = 0.0; }
+            }
+            break;
+          case AST_PROG_LOG:
+            for (int k=0;k<numDerivs_;k++) { d[k] = da[k]/a; }
+            break;
+          case AST_PROG_LOG10:
+            for (int k=0;k<numDerivs_;k++) { d[k] = da[k]/(std::log(ScalarT(10))*a); }
+            break;
+          default:
+            break;
+        }
+      }
+
+      result = vals_[rootReg_];
+      const ScalarT * d = numDerivs_ ? &(derivs_[rootReg_*numDerivs_]) : 0;
+      for (int k=0;k<numDerivs_ && k<derivs.size();k++) { derivs[k] = d[k]; }
+    }
+
+    //-------------------------------------------------------------------------------
+    // Evaluates several programs that share the same code (same codeId) in 
+    // one pass.  Registers are stored lane-major, ie. value(reg,lane) is 
+    // vals[reg*numLanes+lane] and deriv(reg,k,lane) is 
+    // derivs[(reg*numDerivs+k)*numLanes+lane], so each instruction is a set of
+    // unit-stride loops over the lanes.  Leaves are still evaluated one lane 
+    // at a time by their own nodes.  The arithmetic mirrors dx2, so the 
+    // results are the same as calling dx2 on each program.
+    static void dx2Batch(
+        const std::vector<astProgram<ScalarT> *> & lanes,
+        std::vector<ScalarT> & results,
+        std::vector< std::vector<ScalarT> > & derivs,
+        int numDerivs)
+    {
+      const int L = lanes.size();
+      const int N = numDerivs;
+      results.resize(L);
+      derivs.resize(L);
+      if (L == 0) { return; }
+
+      const std::vector<instruction> & code = *(lanes[0]->program_);
+      const int size = code.size();
+      const int rootReg = lanes[0]->rootReg_;
+
+      std::vector<ScalarT> vals(size*L, 0.0);
+      std::vector<ScalarT> dvals(size*N*L, 0.0);
+      std::vector<ScalarT> fp(L, 0.0);
+      std::vector<ScalarT> scratch(N, 0.0);
+
+      for (int ii=0;ii<size;ii++)
+      {
+        const instruction & in = code[ii];
+        ScalarT * v = &(vals[ii*L]);
+        ScalarT * d = N ? &(dvals[ii*N*L]) : 0;
+
+        if (in.opCode == AST_PROG_CONST) 
+        { 
+          for (int l=0;l<L;l++) { v[l] = in.value; }
+          continue; 
+        }
+
+        if (in.opCode == AST_PROG_LEAF)
+        {
+          for (int l=0;l<L;l++)
+          {
+            lanes[l]->leaves_[in.a]->dx2(v[l], scratch, N);
+            for (int k=0;k<N;k++) { d[k*L+l] = scratch[k]; }
+          }
+          continue;
+        }
+
+        const ScalarT * a = &(vals[in.a*L]);
+        const ScalarT * b = (in.b >= 0) ? &(vals[in.b*L]) : 0;
+        const ScalarT * da = N ? &(dvals[in.a*N*L]) : 0;
+        const ScalarT * db = (N && in.b >= 0) ? &(dvals[in.b*N*L]) : 0;
+        const bool aC = in.aConst;
+        const bool bC = in.bConst;
+
+        switch (in.opCode)
+        {
+          case AST_PROG_ADD:
+            for (int l=0;l<L;l++) { v[l] = a[l] + b[l]; }
+            for (int kl=0;kl<N*L;kl++)
+            { d[kl] = (bC)?(aC?(0.0):(da[kl])):(aC?(db[kl]):(da[kl]+db[kl])); }
+            break;
+          case AST_PROG_SUB:
+            for (int l=0;l<L;l++) { v[l] = a[l] - b[l]; }
+            for (int kl=0;kl<N*L;kl++)
+            { d[kl] = (bC)?(aC?(0.0):(da[kl])):(aC?(-db[kl]):(da[kl]-db[kl])); }
+            break;
+          case AST_PROG_MUL:
+            for (int l=0;l<L;l++) { v[l] = a[l] * b[l]; }
+            for (int k=0;k<N;k++)
+            {
+              const int o=k*L;
+              for (int l=0;l<L;l++)
+              { d[o+l] = (bC)?(aC?(0.0):(da[o+l]*b[l])):(aC?(db[o+l]*a[l]):(da[o+l]*b[l]+db[o+l]*a[l])); }
+            }
+            break;
+          case AST_PROG_DIV:
+            for (int l=0;l<L;l++) { v[l] = a[l] / b[l]; }
+            for (int k=0;k<N;k++)
+            {
+              const int o=k*L;
+              for (int l=0;l<L;l++)
+              { 
+                d[o+l] = (bC)?(aC?(0.0):((da[o+l]*b[l])/(b[l]*b[l]))):
+                  (aC?((-db[o+l]*a[l])/(b[l]*b[l])):((da[o+l]*b[l]-db[o+l]*a[l])/(b[l]*b[l]))); 
+              }
+            }
+            break;
+          case AST_PROG_NEG:
+            for (int l=0;l<L;l++) { v[l] = -a[l]; }
+            for (int kl=0;kl<N*L;kl++) { d[kl] = -da[kl]; }
+            break;
+          case AST_PROG_TANH:
+            for (int l=0;l<L;l++) { v[l] = apply_(in.opCode, a[l], ScalarT(0.0)); }
+            for (int l=0;l<L;l++)
+            {
+              const bool inRange = (std::real(a[l]) <= 20 && std::real(a[l]) >= -20);
+              ScalarT cosh_arg = inRange ? std::cosh(a[l]) : ScalarT(0.0);
+              for (int k=0;k<N;k++) { d[k*L+l] = inRange ? ScalarT(da[k*L+l]/(cosh_arg*cosh_arg)) : ScalarT(0.0); }
+            }
+            break;
+          default:
+            {
+              // the remaining one-argument functions have derivatives of the
+              // form da*fp or da/fp
+              for (int l=0;l<L;l++) { v[l] = apply_(in.opCode, a[l], ScalarT(0.0)); }
+
+              bool divide=false;
+              switch (in.opCode)
+              {
+                case AST_PROG_SQRT:  divide=true; for (int l=0;l<L;l++) { fp[l] = 2.*std::sqrt(a[l]); } break;
+                case AST_PROG_EXP:   for (int l=0;l<L;l++) { fp[l] = std::exp(a[l]); } break;
+                case AST_PROG_ABS:   for (int l=0;l<L;l++) { fp[l] = (std::real(a[l]) >= 0) ? 1.0 : -1.0; } break;
+                case AST_PROG_SIN:   for (int l=0;l<L;l++) { fp[l] = std::cos(a[l]); } break;
+                case AST_PROG_COS:   for (int l=0;l<L;l++) { fp[l] = -std::sin(a[l]); } break;
+                case AST_PROG_TAN:   for (int l=0;l<L;l++) { fp[l] = (1.+std::tan(a[l])*std::tan(a[l])); } break;
+                case AST_PROG_ATAN:  divide=true; for (int l=0;l<L;l++) { fp[l] = (1.+a[l]*a[l]); } break;
+                case AST_PROG_SINH:  for (int l=0;l<L;l++) { fp[l] = std::cosh(a[l]); } break;
+                case AST_PROG_COSH:  for (int l=0;l<L;l++) { fp[l] = std::sinh(a[l]); } break;
+                case AST_PROG_LOG:   divide=true; for (int l=0;l<L;l++) { fp[l] = a[l]; } break;
+                case AST_PROG_LOG10: divide=true; for (int l=0;l<L;l++) { fp[l] = (std::log(ScalarT(10))*a[l]); } break;
+                default: for (int l=0;l<L;l++) { fp[l] = 0.0; } break;
+              }
+
+              for (int k=0;k<N;k++)
+              {
+                const int o=k*L;
+                if (divide) { for (int l=0;l<L;l++) { d[o+l] = da[o+l]/fp[l]; } }
+                else        { for (int l=0;l<L;l++) { d[o+l] = da[o+l]*fp[l]; } }
+              }
+            }
+            break;
+        }
+      }
+
+      for (int l=0;l<L;l++)
+      {
+        results[l] = vals[rootReg*L+l];
+        if (derivs[l].size() != N) { derivs[l].clear(); derivs[l].resize(N); }
+        for (int k=0;k<N;k++) { derivs[l][k] = dvals[(rootReg*N+k)*L+l]; }
+      }
+    }
+
+    //-------------------------------------------------------------------------------
+    void output(std::ostream & os)
+    {
+      if (!compiled_) { os << "astProgram: not compiled" << std::endl; return; }
+
+      const std::vector<instruction> & code = *program_;
+      os << "astProgram: " << code.size() << " instructions, root = r" << rootReg_ 
+         << ", shared by " << program_.use_count() << " program(s)" << std::endl;
+      for (int ii=0;ii<code.size();ii++)
+      {
+        const instruction & in = code[ii];
+        os << "  r" << ii << " = op" << in.opCode;
+        if (in.opCode == AST_PROG_CONST) { os << " " << in.value; }
+        else if (in.opCode == AST_PROG_LEAF) { os << " leaf id = " << leaves_[in.a]->getId(); }
+        else 
+        { 
+          os << " r" << in.a; 
+          if (in.b >= 0) { os << " r" << in.b; }
+        }
+        os << std::endl;
+      }
+    }
+
+  private:
+    // For AST_PROG_LEAF, "a" is the index into leaves_
+    struct instruction
+    {
+      instruction () : opCode(AST_PROG_CONST), a(-1), b(-1), value(0.0), aConst(false), bConst(false) {};
+
+      bool operator==(const instruction & right) const
+      {
+        return (opCode == right.opCode && a == right.a && b == right.b && 
+                value == right.value && aConst == right.aConst && bConst == right.bConst);
+      }
+
+      int opCode;
+      int a;
+      int b;
+      ScalarT value;
+      bool aConst;
+      bool bConst;
+    };
+
+    typedef std::tuple<int,int,int,double,double> cseKey;
+
+    //-------------------------------------------------------------------------------
+    static ScalarT apply_(int opCode, const ScalarT & a, const ScalarT & b)
+    {
+      switch (opCode)
+      {
+        case AST_PROG_ADD:   return (a + b);
+        case AST_PROG_SUB:   return (a - b);
+        case AST_PROG_MUL:   return (a * b);
+        case AST_PROG_DIV:   return (a / b);
+        case AST_PROG_NEG:   return (-a);
+        case AST_PROG_SQRT:  return std::sqrt(a);
+        case AST_PROG_EXP:   return std::exp(a);
+        case AST_PROG_ABS:   return std::abs(a);
+        case AST_PROG_SIN:   return std::sin(a);
+        case AST_PROG_COS:   return std::cos(a);
+        case AST_PROG_TAN:   return std::tan(a);
+        case AST_PROG_ATAN:  return std::atan(a);
+        case AST_PROG_SINH:  return std::sinh(a);
+        case AST_PROG_COSH:  return std::cosh(a);
+        case AST_PROG_TANH:
+          if      (std::real(a) > +20) { return ScalarT(+1.0); }
+          else if (std::real(a) < -20) { return ScalarT(-1.0); }
+          return std::tanh(a);
+        case AST_PROG_LOG:   return std::log(a);
+        case AST_PROG_LOG10: return std::log10(a);
+        default:             return ScalarT(0.0);
+      }
+    }
+
+    //-------------------------------------------------------------------------------
+    // Returns the shared copy of "code", creating it if this is the first 
+    // program with these instructions.  The registry only holds weak 
+    // references, so the code is freed along with the last program using it.
+    static std::shared_ptr<const std::vector<instruction> > intern_(const std::vector<instruction> & code, int rootReg)
+    {
+      typedef std::shared_ptr<const std::vector<instruction> > codePtr;
+      typedef std::weak_ptr<const std::vector<instruction> > weakCodePtr;
+      typedef std::unordered_multimap<std::size_t, std::pair<int, weakCodePtr> > registryType;
+      static registryType registry;
+
+      std::size_t key = std::hash<int>()(rootReg);
+      for (int ii=0;ii<code.size();ii++)
+      {
+        const instruction & in = code[ii];
+        key = key*31 + std::hash<int>()(in.opCode);
+        key = key*31 + std::hash<int>()(in.a);
+        key = key*31 + std::hash<int>()(in.b);
+        key = key*31 + std::hash<double>()(std::real(in.value));
+        key = key*31 + std::hash<double>()(std::imag(in.value));
+      }
+
+      std::pair<typename registryType::iterator, typename registryType::iterator> range = registry.equal_range(key);
+      for (typename registryType::iterator it=range.first; it!=range.second; )
+      {
+        codePtr existing = it->second.second.lock();
+        if (!existing) { it = registry.erase(it); continue; }
+        if (it->second.first == rootReg && *existing == code) { return existing; }
+        ++it;
+      }
+
+      codePtr newCode = std::make_shared<const std::vector<instruction> >(code);
+      registry.insert(std::make_pair(key, std::make_pair(rootReg, weakCodePtr(newCode))));
+      return newCode;
+    }
+
+    //-------------------------------------------------------------------------------
+    int emitConst_(const ScalarT & value)
+    {
+      // NaN can't be used as a map key
+      const bool share = (value == value);
+      cseKey key(AST_PROG_CONST,-1,-1,std::real(value),std::imag(value));
+      if (share)
+      {
+        typename std::map<cseKey,int>::iterator it = cseMap_.find(key);
+        if (it != cseMap_.end()) { return it->second; }
+      }
+
+      instruction in;
+      in.opCode = AST_PROG_CONST;
+      in.value = value;
+      code_.push_back(in);
+      if (share) { cseMap_[key] = code_.size()-1; }
+      return code_.size()-1;
+    }
+
+    //-------------------------------------------------------------------------------
+    // Leaves are shared by pointer.  Leaves that may carry state (sdt, ddt, 
+    // random, ...) are not shared at all.
+    int emitLeaf_(astNode<ScalarT> * node, bool share)
+    {
+      if (share)
+      {
+        typename std::unordered_map<astNode<ScalarT> *,int>::iterator it = leafPtrMap_.find(node);
+        if (it != leafPtrMap_.end()) { return it->second; }
+      }
+
+      instruction in;
+      in.opCode = AST_PROG_LEAF;
+      in.a = leaves_.size();
+      code_.push_back(in);
+      leaves_.push_back(node);
+      if (share) { leafPtrMap_[node] = code_.size()-1; }
+      return code_.size()-1;
+    }
+
+    //-------------------------------------------------------------------------------
+    int emitOp_(int opCode, int a, int b)
+    {
+      const bool aConst = (code_[a].opCode == AST_PROG_CONST);
+      const bool bConst = (b < 0) || (code_[b].opCode == AST_PROG_CONST);
+
+      if (aConst && bConst) // fold
+      {
+        return emitConst_(apply_(opCode, code_[a].value, (b>=0)?code_[b].value:ScalarT(0.0)));
+      }
+
+      // a+b and a*b are the same as b+a and b*a
+      if ((opCode == AST_PROG_ADD || opCode == AST_PROG_MUL) && b < a) { std::swap(a,b); }
+
+      cseKey key(opCode,a,b,0.0,0.0);
+      typename std::map<cseKey,int>::iterator it = cseMap_.find(key);
+      if (it != cseMap_.end()) { return it->second; }
+
+      instruction in;
+      in.opCode = opCode;
+      in.a = a;
+      in.b = b;
+      in.aConst = (code_[a].opCode == AST_PROG_CONST);
+      in.bConst = (b >= 0) && (code_[b].opCode == AST_PROG_CONST);
+      code_.push_back(in);
+      cseMap_[key] = code_.size()-1;
+      return code_.size()-1;
+    }
+
+    //-------------------------------------------------------------------------------
+    // throws away everything emitted after "size" (used when an inline fails)
+    void truncate_(int size)
+    {
+      code_.resize(size);
+      int numLeaves=0;
+      for (int ii=0;ii<size;ii++) { if (code_[ii].opCode == AST_PROG_LEAF) { numLeaves++; } }
+      leaves_.resize(numLeaves);
+      for (typename std::map<cseKey,int>::iterator it=cseMap_.begin();it!=cseMap_.end();)
+      { if (it->second >= size) { cseMap_.erase(it++); } else { ++it; } }
+      for (typename std::unordered_map<astNode<ScalarT> *,int>::iterator it=leafPtrMap_.begin();it!=leafPtrMap_.end();)
+      { if (it->second >= size) { it = leafPtrMap_.erase(it); } else { ++it; } }
+    }
+
+    //-------------------------------------------------------------------------------
+    static int unaryOpCode_(astNode<ScalarT> * node)
+    {
+      if (dynamic_cast<unaryMinusOp<ScalarT> *>(node)) { return AST_PROG_NEG; }
+      if (dynamic_cast<sqrtOp<ScalarT> *>(node))       { return AST_PROG_SQRT; }
+      if (dynamic_cast<expOp<ScalarT> *>(node))        { return AST_PROG_EXP; }
+      if (dynamic_cast<absOp<ScalarT> *>(node))        { return AST_PROG_ABS; }
+      if (dynamic_cast<sinOp<ScalarT> *>(node))        { return AST_PROG_SIN; }
+      if (dynamic_cast<cosOp<ScalarT> *>(node))        { return AST_PROG_COS; }
+      if (dynamic_cast<tanOp<ScalarT> *>(node))        { return AST_PROG_TAN; }
+      if (dynamic_cast<atanOp<ScalarT> *>(node))       { return AST_PROG_ATAN; }
+      if (dynamic_cast<sinhOp<ScalarT> *>(node))       { return AST_PROG_SINH; }
+      if (dynamic_cast<coshOp<ScalarT> *>(node))       { return AST_PROG_COSH; }
+      if (dynamic_cast<tanhOp<ScalarT> *>(node))       { return AST_PROG_TANH; }
+      if (dynamic_cast<logOp<ScalarT> *>(node))        { return AST_PROG_LOG; }
+      if (dynamic_cast<log10Op<ScalarT> *>(node))      { return AST_PROG_LOG10; }
+      return -1;
+    }
+
+    //-------------------------------------------------------------------------------
+    static int binaryOpCode_(astNode<ScalarT> * node)
+    {
+      if (dynamic_cast<binaryAddOp<ScalarT> *>(node))   { return AST_PROG_ADD; }
+      if (dynamic_cast<binaryMinusOp<ScalarT> *>(node)) { return AST_PROG_SUB; }
+      if (dynamic_cast<binaryMulOp<ScalarT> *>(node))   { return AST_PROG_MUL; }
+      if (dynamic_cast<binaryDivOp<ScalarT> *>(node))   { return AST_PROG_DIV; }
+      return -1;
+    }
+
+    //-------------------------------------------------------------------------------
+    // Lowers "node" and returns its register, or -1 if it can't be lowered.
+    // "args" maps the dummy arguments of the .FUNC body currently being 
+    // inlined to the registers of the actual arguments.  Inside a body 
+    // (depth>0) a node that can't be lowered fails the whole inline, since 
+    // an opaque node there might depend on the dummy arguments.
+    int lower_(astNode<ScalarT> * node, std::unordered_map<astNode<ScalarT> *, int> & args, int depth)
+    {
+      if (node->numvalType()) { return emitConst_(node->val()); }
+      if (dynamic_cast<piConstOp<ScalarT> *>(node) || dynamic_cast<CtoKConstOp<ScalarT> *>(node))
+      {
+        return emitConst_(node->val());
+      }
+
+      const std::vector<Teuchos::RCP<astNode<ScalarT> > > & children = node->getChildren();
+
+      int opCode = binaryOpCode_(node);
+      if (opCode >= 0 && children.size() == 2)
+      {
+        int a = lower_(children[0].get(), args, depth); if (a < 0) return -1;
+        int b = lower_(children[1].get(), args, depth); if (b < 0) return -1;
+        return emitOp_(opCode, a, b);
+      }
+
+      opCode = unaryOpCode_(node);
+      if (opCode >= 0 && children.size() == 1)
+      {
+        int a = lower_(children[0].get(), args, depth); if (a < 0) return -1;
+        return emitOp_(opCode, a, -1);
+      }
+
+      if (dynamic_cast<unaryPlusOp<ScalarT> *>(node) && children.size() == 1)
+      {
+        return lower_(children[0].get(), args, depth);
+      }
+
+      if (dynamic_cast<paramOp<ScalarT> *>(node))
+      {
+        typename std::unordered_map<astNode<ScalarT> *,int>::iterator it = args.find(node);
+        if (it != args.end()) { return it->second; }
+        if (depth > 0 && node->getFunctionArgType()) { return -1; }
+        return emitLeaf_(node, true);
+      }
+
+      funcOp<ScalarT> * func = dynamic_cast<funcOp<ScalarT> *>(node);
+      if (func)
+      {
+        int reg = inlineFunc_(func, args, depth);
+        if (reg >= 0) { return reg; }
+        return (depth > 0) ? -1 : emitLeaf_(node, false);
+      }
+
+      // voltages, currents, specials (time, temp, ...) and the other 
+      // childless nodes only read values from outside the tree.
+      if (children.empty()) { return emitLeaf_(node, true); }
+
+      return (depth > 0) ? -1 : emitLeaf_(node, false);
+    }
+
+    //-------------------------------------------------------------------------------
+    int inlineFunc_(funcOp<ScalarT> * func, std::unordered_map<astNode<ScalarT> *, int> & args, int depth)
+    {
+      static const int maxInlineDepth = 32;
+
+      std::vector<Teuchos::RCP<astNode<ScalarT> > > & funcArgs = func->getFuncArgs();
+      std::vector<Teuchos::RCP<astNode<ScalarT> > > & dummyArgs = func->getDummyFuncArgs();
+      Teuchos::RCP<astNode<ScalarT> > & body = func->getFunctionNode();
+
+      if (!func->getNodeResolved() || !func->getArgsResolved() || Teuchos::is_null(body) ||
+          funcArgs.size() != dummyArgs.size() || func->getHasStateNodes() || depth >= maxInlineDepth)
+      {
+        return -1;
+      }
+
+      const int savedSize = code_.size();
+
+      std::unordered_map<astNode<ScalarT> *, int> bodyArgs;
+      for (int ii=0;ii<funcArgs.size();ii++)
+      {
+        int reg = lower_(funcArgs[ii].get(), args, depth);
+        if (reg < 0) { truncate_(savedSize); return -1; }
+        bodyArgs[dummyArgs[ii].get()] = reg;
+      }
+
+      int reg = lower_(body.get(), bodyArgs, depth+1);
+      if (reg < 0) { truncate_(savedSize); }
+      return reg;
+    }
+
+    std::shared_ptr<const std::vector<instruction> > program_;
+    std::vector<instruction> code_; // only used while lowering
+    std::vector<astNode<ScalarT> *> leaves_;
+    std::vector<ScalarT> vals_;
+    std::vector<ScalarT> derivs_; // program_->size() x numDerivs_, row major
+    std::vector<ScalarT> scratch_;
+
+    std::map<cseKey,int> cseMap_;
+    std::unordered_map<astNode<ScalarT> *,int> leafPtrMap_;
+
+    astNode<ScalarT> * root_;
+    int rootReg_;
+    int numDerivs_;
+    bool compiled_;
+};
+
+#endif
@@ -126,6 +126,9 @@ public:
 
   virtual void setRFParamsRequested(std::string type) {}
 
+protected:
+  bool putNonSolutionValues_(newExpression & expr);
+
 private:
 
 };
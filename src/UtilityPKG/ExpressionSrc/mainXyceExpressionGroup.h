@@ -113,6 +113,8 @@ public:
 
   ~mainXyceExpressionGroup ();
 
+  virtual bool putValues(newExpression & expr);
+
   virtual bool getSolutionVal(const std::string & nodeName, double & retval );
   virtual bool getSolutionVal(const std::string & nodeName, std::complex<double> & retval );
 
@@ -158,7 +160,18 @@ protected:
   double time_, temp_, VT_, freq_, gmin_;
   double dt_, alpha_;
 
+  virtual void getLocalSolutionValues_(
+      const std::vector<int> & gids,
+      std::vector<double> & realVals,
+      std::vector<double> & imagVals);
+
 private:
+  bool canCacheGIDs_() const;
+
+  // node/device name -> GID, filled in once a name has been found on some
+  // processor.  The GID is -1 on processors that do not own the variable.
+  std::unordered_map<std::string, int> solutionGIDMap_;
+  std::unordered_map<std::string, int> currentGIDMap_;
  
 };
 
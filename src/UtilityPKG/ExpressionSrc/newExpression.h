@@ -57,6 +57,7 @@
 
 // new code includes:
 #include <ast.h>
+#include <astProgram.h>
 #include <ExpressionType.h>
 #include <expressionGroup.h>
 #include <checkGroundName.h>
@@ -76,6 +77,7 @@ class newExpression
 friend class baseExpressionGroup;
 friend class deviceExpressionGroup;
 friend class outputsXyceExpressionGroup;
+friend class mainXyceExpressionGroup;
 
 public:
   newExpression () :
@@ -602,6 +604,7 @@ public:
     piNodePtr_   = right.piNodePtr_;
     CtoKNodePtr_   = right.CtoKNodePtr_;
     astNodePtr_ = right.astNodePtr_; // copy over the whole tree
+    astProgram_.clear();
 
     return *this;
   };
@@ -633,6 +636,12 @@ public:
   bool evaluate (usedType &result, std::vector< usedType > &derivs);
   bool evaluateFunction (usedType &result, bool efficiencyOn=false);
 
+  static bool evaluateBatch (
+      const std::vector<newExpression *> & exprs,
+      std::vector<usedType> & results,
+      std::vector< std::vector<usedType> > & derivs,
+      std::vector<bool> & changed);
+
   // supporting "changed" boolean .... 
   void clearOldResult()  
   { 
@@ -919,6 +928,13 @@ public:
 
   static void clearProcessSuccessfulTimeStepMap () { staticsContainer::processSuccessfulStepMap.clear(); }
 
+  // if true, the AST is compiled into an astProgram before it is evaluated
+  static void setCompileAst (bool compile) { compileAst_ = compile; }
+  static bool getCompileAst () { return compileAst_; }
+
+  // true if the last evaluation used the compiled astProgram rather than the tree walk
+  bool isCompiled () const { return astProgram_.isCompiled(); }
+
   void processSuccessfulTimeStep ();
 
   int getNumDdt () { return ddtOpVec_.size(); }
@@ -935,6 +951,7 @@ public:
 
 private:
   void setupDerivatives_ ();
+  void setupAstProgram_ (bool force=false);
   void checkIsConstant_();
   bool getValuesFromGroup_();
 
@@ -1112,6 +1129,9 @@ private:
   opVectorContainers<usedType> opVectors_;
   std::vector<usedType> oldSolVals_;
 
+  static bool compileAst_;
+  astProgram<usedType> astProgram_;
+
   //-------------------------------------------------------------------------------
   // This unordered_map is used for maintaining AST node parents.
   // The first entry is the id_ of a node, and the second entry is a vector
@@ -206,6 +206,8 @@ private:
   Op::OpList sparamOps_;
   Op::OpList yparamOps_;
   Op::OpList zparamOps_;
+
+  Op::OpList allOps_; // does not own the Ops
 };
 
 }
@@ -157,6 +157,12 @@ public:
   bool evaluate (double &result, std::vector< double > &derivs);
   bool evaluateFunction (double &result, bool efficiencyOn=false);
 
+  static bool evaluateBatch (
+      const std::vector<Expression *> & exprs,
+      std::vector<double> & results,
+      std::vector< std::vector<double> > & derivs,
+      std::vector<bool> & changed);
+
   void clearOldResult ();
 
   bool getBreakPoints(std::vector<Util::BreakPoint> &breakPointTimes);
@@ -178,6 +184,8 @@ public:
   void treatAsTempAndConvert();
 
   static void clearProcessSuccessfulTimeStepMap ();
+  static void setCompileExpressions (bool compile);
+  static bool getCompileExpressions ();
   void processSuccessfulTimeStep ();
 
   // ddt information.  This is for Bsrc support of ddt.